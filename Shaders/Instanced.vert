@@ -0,0 +1,50 @@
+/*******************************************************************************/
+/*!
+\par        Image Engine
+\file       Instanced.vert
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief      Vertex shader for instanced sprites.
+
+            Every vertex is a corner of the same unit quad, the sprite comes
+            from the per instance attributes. The corner is placed with the
+            center, size and the cos and sin of the rotation the same way
+            Renderer::WriteQuadVertices places it on the cpu, and picks its
+            texture coordinate from the texture rect. Used with Tex.frag.
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+            or disclosure of this file or its contents without the prior
+            written consent of DigiPen Institute of Technology is prohibited.
+*/
+/*******************************************************************************/
+
+#version 450 core
+
+layout(location = 0) in vec2 a_Corner; //-1 or 1 on each axis
+layout(location = 1) in vec3 a_Position;
+layout(location = 2) in vec2 a_Scale;
+layout(location = 3) in vec2 a_CosSin;
+layout(location = 4) in vec4 a_TexRect;
+layout(location = 5) in vec4 a_Color;
+layout(location = 6) in float a_TexIdx;
+
+out vec4 v_Color;
+out vec2 v_TexCoord;
+out float v_TexIdx;
+
+uniform mat4 u_ViewProjMtx;
+
+void main(){
+	vec2 halfScale = a_Scale * 0.5;
+	vec2 axisX = vec2(a_CosSin.x * halfScale.x, a_CosSin.y * halfScale.x);
+	vec2 axisY = vec2(-a_CosSin.y * halfScale.y, a_CosSin.x * halfScale.y);
+	vec2 pos = a_Position.xy + a_Corner.x * axisX + a_Corner.y * axisY;
+
+	v_Color = a_Color;
+	v_TexCoord = vec2(a_Corner.x < 0.0 ? a_TexRect.x : a_TexRect.z,
+		a_Corner.y < 0.0 ? a_TexRect.y : a_TexRect.w);
+	v_TexIdx = a_TexIdx;
+	gl_Position = u_ViewProjMtx * vec4(pos, a_Position.z, 1.0);
+}
@@ -29,6 +29,6 @@ in float v_TexIdx;
 uniform sampler2D u_Tex[32]; //TODO CHANGE THIS IN FUTURE
 
 void main(){
-	vec4 texColor = texture2D(u_Tex[int(v_TexIdx)], v_TexCoord);
+	vec4 texColor = texture(u_Tex[int(v_TexIdx)], v_TexCoord);
 	fragColor = texColor * v_Color;
 }
\ No newline at end of file
@@ -15,18 +15,114 @@
 /******************************************************************************/
 #pragma once
 #include "Math/MathUtils.h"
+#include <algorithm>
+#include <cstdint>
+#include <string>
 #include <rapidjson/document.h>
 #include <Core/Serialization/SerializationManager.hpp>
 
+//collision category bits, a pair is only tested when each collider's
+//category is in the other's mask
+namespace CollisionLayer {
+	constexpr uint32_t DEFAULT{ 1u << 0 };
+	constexpr uint32_t STATIC{ 1u << 1 };
+	constexpr uint32_t PLAYER{ 1u << 2 };
+	constexpr uint32_t ALL{ 0xFFFFFFFFu };
+}
+
+//narrowphase shape, the size always comes from the rigidbody dimension
+//CIRCLE: diameter is dimension.x
+//CAPSULE: rounded segment along the longer side, radius is half the shorter side
+//POLYGON: convex, counter clockwise, vertices in [-0.5, 0.5] scaled by dimension,
+//clockwise input is rewound and concave or degenerate input falls back to BOX
+enum class ColliderShape : uint32_t { BOX = 0, CIRCLE, CAPSULE, POLYGON, COUNT };
+constexpr uint32_t MAX_POLYGON_VERTICES{ 8 };
+
 struct BoxCollider {
 	//this is just a struct to tell the collision system to consider this object for colliding
 	//dimensions and everythign are in rigidbody
+	uint32_t category{ CollisionLayer::DEFAULT };
+	uint32_t mask{ CollisionLayer::ALL };
+	//overlap only, reports begin/end but is never pushed apart
+	bool isTrigger{ false };
+	ColliderShape shape{ ColliderShape::BOX };
+	Vec2 vertices[MAX_POLYGON_VERTICES]{};
+	uint32_t vertexCount{};
+
 	BoxCollider() = default;
-	BoxCollider([[maybe_unused]] rapidjson::Value const& obj) {
+	BoxCollider(uint32_t category, uint32_t mask, bool trigger = false) : category{ category }, mask{ mask }, isTrigger{ trigger } {}
+	BoxCollider(ColliderShape shape, uint32_t category = CollisionLayer::DEFAULT, uint32_t mask = CollisionLayer::ALL) :
+		category{ category }, mask{ mask }, shape{ shape } {}
+	BoxCollider(rapidjson::Value const& obj) {
+		if (obj.HasMember("category")) category = obj["category"].GetUint();
+		if (obj.HasMember("mask")) mask = obj["mask"].GetUint();
+		if (obj.HasMember("trigger")) isTrigger = obj["trigger"].GetBool();
+		if (obj.HasMember("shape")) shape = static_cast<ColliderShape>(obj["shape"].GetUint());
+		if (obj.HasMember("vertCount")) {
+			vertexCount = std::min(obj["vertCount"].GetUint(), MAX_POLYGON_VERTICES);
+			for (uint32_t i{}; i < vertexCount; ++i) {
+				vertices[i] = Vec2{ obj[("vertX" + std::to_string(i)).c_str()].GetFloat(),
+					obj[("vertY" + std::to_string(i)).c_str()].GetFloat() };
+			}
+		}
+		if (shape == ColliderShape::POLYGON) ValidatePolygon();
+	}
+	/*  _________________________________________________________________________ */
+	/*! SetPolygon
+
+	@param verts Convex vertices in [-0.5, 0.5], in either winding.
+	@param count Number of vertices, at most MAX_POLYGON_VERTICES.
+
+	@return none.
+
+	Makes this collider a polygon, see ValidatePolygon.
+	*/
+	void SetPolygon(Vec2 const* verts, uint32_t count) {
+		shape = ColliderShape::POLYGON;
+		vertexCount = std::min(count, MAX_POLYGON_VERTICES);
+		for (uint32_t i{}; i < vertexCount; ++i) vertices[i] = verts[i];
+		ValidatePolygon();
+	}
+	/*  _________________________________________________________________________ */
+	/*! ValidatePolygon
+
+	@return none.
+
+	The narrowphase needs a convex, counter clockwise polygon to get its
+	normals right. Clockwise vertices are reversed, fewer than 3 vertices, no
+	area, a repeated vertex or a concave corner turn the collider back into
+	a box.
+	*/
+	void ValidatePolygon() {
+		float area{};
+		for (uint32_t i{}; i < vertexCount; ++i) area += cross(vertices[i], vertices[(i + 1) % vertexCount]);
+		if (area < 0.f) std::reverse(vertices, vertices + vertexCount);
 
+		//every vertex on the inner side of every edge, which also rules out self intersection
+		bool convex{ vertexCount >= 3 && area != 0.f };
+		for (uint32_t i{}; convex && i < vertexCount; ++i) {
+			Vec2 edge{ vertices[(i + 1) % vertexCount] - vertices[i] };
+			convex = edge.x != 0.f || edge.y != 0.f;
+			for (uint32_t j{}; convex && j < vertexCount; ++j) convex = cross(edge, vertices[j] - vertices[i]) >= 0.f;
+		}
+		if (!convex) {
+			shape = ColliderShape::BOX;
+			vertexCount = 0;
+		}
 	}
 	bool Serialize(rapidjson::Value& obj) {
 		Serializer::SerializationManager::GetInstance()->InsertValue(obj, "collider", true);
+		Serializer::SerializationManager::GetInstance()->InsertValue(obj, "category", category);
+		Serializer::SerializationManager::GetInstance()->InsertValue(obj, "mask", mask);
+		Serializer::SerializationManager::GetInstance()->InsertValue(obj, "trigger", isTrigger);
+		Serializer::SerializationManager::GetInstance()->InsertValue(obj, "shape", static_cast<uint32_t>(shape));
+		if (shape == ColliderShape::POLYGON) {
+			Serializer::SerializationManager::GetInstance()->InsertValue(obj, "vertCount", vertexCount);
+			for (uint32_t i{}; i < vertexCount; ++i) {
+				Serializer::SerializationManager::GetInstance()->InsertValue(obj, "vertX" + std::to_string(i), vertices[i].x);
+				Serializer::SerializationManager::GetInstance()->InsertValue(obj, "vertY" + std::to_string(i), vertices[i].y);
+			}
+		}
 		return true;
 	}
 };
\ No newline at end of file
@@ -0,0 +1,102 @@
+/******************************************************************************/
+/*!
+\par        Image Engine
+\file       Joint.hpp
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief      joint ecs cmpnt, constrains the entity's body to another body
+			or to the world
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+			or disclosure of this file or its contents without the prior
+			written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+#pragma once
+#include "Math/MathUtils.h"
+#include <Core/Types.hpp>
+#include <cstdint>
+#include <rapidjson/document.h>
+#include <Core/Serialization/SerializationManager.hpp>
+
+//DISTANCE: keeps the anchors length apart, a rope only stops them moving further
+//REVOLUTE: pins the anchors together, the bodies turn freely (or by motor) about it
+//PRISMATIC: the anchor slides along axis without turning, the motor drives it along
+enum class JointType : uint32_t { DISTANCE = 0, REVOLUTE, PRISMATIC };
+//joined to the world instead of a body, otherAnchor is then a world point
+constexpr Entity JOINT_WORLD{ MAX_ENTITIES };
+
+//one scalar constraint, its velocity is
+//dot(dir, vSelf - vOther) + armSelf * wSelf - armOther * wOther
+struct JointRow {
+	Vec2 dir{};
+	float armOther{}, armSelf{};
+	float mass{};
+	float bias{};
+	float impulse{};
+};
+
+struct Joint {
+	JointType type{ JointType::REVOLUTE };
+	//saved as the other body's index in the level, EntitySerializationSystem maps it back on load
+	Entity other{ JOINT_WORLD };
+	//local to this body
+	Vec2 localAnchor{};
+	//local to the other body, world space when joined to the world
+	Vec2 otherAnchor{};
+	//prismatic only, in the other body's frame (world when joined to the world)
+	Vec2 axis{ 1.f, 0.f };
+	//distance only, 0 takes the distance between the anchors on the first step
+	float length{};
+	bool isRope{ false };
+	bool enableMotor{ false };
+	//units per second along axis for prismatic, radians per second for revolute
+	float motorSpeed{};
+	float maxMotorForce{};
+
+	//solver state, impulses are kept between steps to warm start the next one
+	Vec2 pointImpulse{};
+	JointRow axial{}, angular{}, motor{};
+	Mat22 pointMass{};
+	Vec2 pointBias{};
+	Vec2 rOther{}, rSelf{};
+	float motorMaxImpulse{};
+	float referenceAngle{};
+	bool isReferenceSet{ false };
+	bool isActive{ false };
+
+	Joint() = default;
+	Joint(JointType type, Entity other, Vec2 const& localAnchor, Vec2 const& otherAnchor) :
+		type{ type }, other{ other }, localAnchor{ localAnchor }, otherAnchor{ otherAnchor } {}
+	Joint(rapidjson::Value const& obj) {
+		type = static_cast<JointType>(obj["type"].GetUint());
+		other = obj["other"].GetUint();
+		localAnchor = Vec2{ obj["anchorX"].GetFloat(), obj["anchorY"].GetFloat() };
+		otherAnchor = Vec2{ obj["otherAnchorX"].GetFloat(), obj["otherAnchorY"].GetFloat() };
+		if (obj.HasMember("axisX")) axis = Vec2{ obj["axisX"].GetFloat(), obj["axisY"].GetFloat() };
+		if (obj.HasMember("length")) length = obj["length"].GetFloat();
+		if (obj.HasMember("rope")) isRope = obj["rope"].GetBool();
+		if (obj.HasMember("motor")) enableMotor = obj["motor"].GetBool();
+		if (obj.HasMember("motorSpeed")) motorSpeed = obj["motorSpeed"].GetFloat();
+		if (obj.HasMember("maxMotorForce")) maxMotorForce = obj["maxMotorForce"].GetFloat();
+	}
+	bool Serialize(rapidjson::Value& obj) {
+		std::shared_ptr< Serializer::SerializationManager> sm {Serializer::SerializationManager::GetInstance()};
+		sm->InsertValue(obj, "type", static_cast<uint32_t>(type));
+		sm->InsertValue(obj, "other", other);
+		sm->InsertValue(obj, "anchorX", localAnchor.x);
+		sm->InsertValue(obj, "anchorY", localAnchor.y);
+		sm->InsertValue(obj, "otherAnchorX", otherAnchor.x);
+		sm->InsertValue(obj, "otherAnchorY", otherAnchor.y);
+		sm->InsertValue(obj, "axisX", axis.x);
+		sm->InsertValue(obj, "axisY", axis.y);
+		sm->InsertValue(obj, "length", length);
+		sm->InsertValue(obj, "rope", isRope);
+		sm->InsertValue(obj, "motor", enableMotor);
+		sm->InsertValue(obj, "motorSpeed", motorSpeed);
+		sm->InsertValue(obj, "maxMotorForce", maxMotorForce);
+		return true;
+	}
+};
@@ -41,6 +41,7 @@ public:
 	glm::mat4 const& GetProjMtx() const;
 	glm::mat4 const& GetViewMtx() const;
 	glm::mat4 const& GetViewProjMtx() const;
+	void GetViewBounds(glm::vec2& min, glm::vec2& max) const;
 
 	void ComputeViewProjMtx();
 
@@ -18,6 +18,7 @@
 #include <rapidjson/document.h>
 #include <Core/Serialization/SerializationManager.hpp>
 #include <Math/MathUtils.h>
+#include <Math/FastTrig.hpp>
 
 struct RigidBody
 {
@@ -38,8 +39,16 @@ struct RigidBody
 
 	bool isLockRotation{ false };
 	bool isGrounded{ false };
+	//fast body, swept against the other colliders each step so it cannot tunnel
+	bool isBullet{ false };
 
 	Vec2 acceleration{};
+
+	//sin and cos of rotation, refreshed by the physics system when it turns the body
+	float rotationSin{}, rotationCos{ 1.f };
+	//rotation the pair above belongs to
+	float cachedRotation{};
+
 	RigidBody() = default;
 	RigidBody(Vec2 pos, float rotation, float mass, Vec2 dimension, bool rotate = false) {
 		this->position = pos;
@@ -50,24 +59,56 @@ struct RigidBody
 		this->friction = 0.2f;
 
 		SetMass(mass);
+		CacheRotation();
 	}
 	RigidBody(rapidjson::Value const& obj) : RigidBody{
 		Vec2{ obj["posX"].GetFloat(), obj["posY"].GetFloat() },
 		obj["rotation"].GetFloat(), obj["mass"].GetFloat(), 
 		Vec2{ obj["dimX"].GetFloat(), obj["dimY"].GetFloat() },
 		obj["lockRotate"].GetBool()
-	} {}
+	} {
+		if (obj.HasMember("bullet")) isBullet = obj["bullet"].GetBool();
+	}
 	void SetMass(float m) {
 		mass = m;
-		if (mass < FLOAT_MAX) {
+		//mass of 0 (prefabs) or FLOAT_MAX (editor) both mean static
+		if (mass > 0.f && mass < FLOAT_MAX) {
 			invMass = 1.0f / mass;
 			inertia = mass * (dimension.x * dimension.x + dimension.y * dimension.y) / 12.0f;
 			invInertia = 1.0f / inertia;
 		}
 		else {
+			invMass = 0.f;
 			inertia = FLOAT_MAX;
+			invInertia = 0.f;
 		}
 	}
+	bool IsStatic() const { return invMass == 0.f; }
+	/*  _________________________________________________________________________ */
+	/*! CacheRotation
+
+	@return none.
+
+	Recomputes the sin and cos of the current rotation.
+	*/
+	void CacheRotation() {
+		SinCos(rotation, rotationSin, rotationCos);
+		cachedRotation = rotation;
+	}
+	/*  _________________________________________________________________________ */
+	/*! GetRotationCosSin
+
+	@return The cos and sin of the rotation as x and y.
+
+	Reads the cached pair, rotation set from outside the physics step (editor,
+	scripts) since the last refresh is computed on the spot instead.
+	*/
+	Vec2 GetRotationCosSin() const {
+		if (rotation == cachedRotation) return Vec2{ rotationCos, rotationSin };
+		Vec2 cs{};
+		SinCos(rotation, cs.y, cs.x);
+		return cs;
+	}
 	bool Serialize(rapidjson::Value& obj) {
 		std::shared_ptr< Serializer::SerializationManager> sm {Serializer::SerializationManager::GetInstance()};
 
@@ -78,6 +119,7 @@ struct RigidBody
 		sm->InsertValue(obj, "posX", position.x);
 		sm->InsertValue(obj, "posY", position.y);
 		sm->InsertValue(obj, "lockRotate", isLockRotation);
+		sm->InsertValue(obj, "bullet", isBullet);
 		return true;
 	}
 };
@@ -37,9 +37,10 @@ struct Sprite {
 	glm::vec4 color{};
 	std::shared_ptr<SubTexture> texture{};
 	Layer layer{};
+	bool isStatic{}; //never moves, baked into a static batch by the RenderSystem
 
 	Sprite() = default;
-	Sprite(glm::vec4 color, std::shared_ptr<SubTexture> tex, Layer lyr = Layer::FOREGROUND) : color{ color }, texture{ tex }, layer{lyr} {}
+	Sprite(glm::vec4 color, std::shared_ptr<SubTexture> tex, Layer lyr = Layer::FOREGROUND, bool stat = false) : color{ color }, texture{ tex }, layer{lyr}, isStatic{stat} {}
 	Sprite([[maybe_unused]] rapidjson::Value const& obj) {
 		color = { 1,1,1,1 };
 		texture = nullptr;
@@ -1,5 +1,8 @@
 #pragma once
 #include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <cstdint>
+#include <Math/FastTrig.hpp>
 #include <Core/Serialization/SerializationManager.hpp>
 
 
@@ -10,6 +13,14 @@ struct Transform
 	glm::vec3 rotation{};
 	glm::vec3 scale{};
 
+	//caches of the values above, refreshed on read when any of them changed
+	mutable glm::mat4 matrix{ 1.f };
+	mutable float rotationCos{ 1.f }, rotationSin{};
+	mutable glm::vec3 cachedPosition{}, cachedRotation{}, cachedScale{};
+	mutable bool isMatrixDirty{ true };
+	//bumped every time position, rotation or scale is seen to change, 0 until first read
+	mutable uint64_t version{};
+
 	Transform() = default;
 	Transform(glm::vec3 const& pos, glm::vec3 const& rot, glm::vec3 const& sca) : position{ pos }, rotation{ rot }, scale{ sca } {}
 	Transform(rapidjson::Value const& obj) {
@@ -17,6 +28,57 @@ struct Transform
 		rotation = glm::vec3{ obj["rotX"].GetFloat(), obj["rotY"].GetFloat(), obj["rotZ"].GetFloat() };
 		scale = glm::vec3{ obj["scaleX"].GetFloat(), obj["scaleY"].GetFloat(), obj["scaleZ"].GetFloat() };
 	}
+	/*  _________________________________________________________________________ */
+	/*! Refresh
+
+	@return true if position, rotation or scale changed since the last read.
+
+	Bumps the version and refreshes the sin and cos of rotation.z when the
+	transform changed. The matrix is only rebuilt when someone asks for it.
+	*/
+	bool Refresh() const {
+		if (version != 0 && position == cachedPosition && rotation == cachedRotation && scale == cachedScale) {
+			return false;
+		}
+		if (version == 0 || rotation.z != cachedRotation.z) {
+			Image::SinCos(glm::radians(rotation.z), rotationSin, rotationCos);
+		}
+		cachedPosition = position;
+		cachedRotation = rotation;
+		cachedScale = scale;
+		isMatrixDirty = true;
+		++version;
+		return true;
+	}
+	/*  _________________________________________________________________________ */
+	/*! GetMatrix
+
+	@return The translate * rotate(z) * scale matrix of the transform.
+
+	Returns the cached matrix, rebuilding it first if the transform changed
+	since it was last built.
+	*/
+	glm::mat4 const& GetMatrix() const {
+		Refresh();
+		if (isMatrixDirty) {
+			matrix = glm::translate(glm::mat4{ 1.f }, position)
+				* glm::rotate(glm::mat4{ 1.f }, glm::radians(rotation.z), { 0.f, 0.f, 1.f })
+				* glm::scale(glm::mat4{ 1.f }, { scale.x, scale.y, 1.f });
+			isMatrixDirty = false;
+		}
+		return matrix;
+	}
+	/*  _________________________________________________________________________ */
+	/*! GetRotationCosSin
+
+	@return The cos and sin of rotation.z as x and y.
+
+	Returns the cached pair, recomputing it first if the rotation changed.
+	*/
+	glm::vec2 GetRotationCosSin() const {
+		Refresh();
+		return { rotationCos, rotationSin };
+	}
 	bool Serialize(rapidjson::Value& obj) {
 		std::shared_ptr< Serializer::SerializationManager> sm {Serializer::SerializationManager::GetInstance()};
 
@@ -109,7 +109,8 @@ Creates a new entity and notifies all systems of its creation.
 
 @return Entity The cloned entity.
 
-Creates a clone of the specified entity, including all its components.
+Creates a clone of the specified entity, including all its components,
+and notifies all systems of the clone.
 */
 
 	Entity CloneEntity(Entity entity) {
@@ -119,6 +120,10 @@ Creates a clone of the specified entity, including all its components.
 		auto signature = mEntityManager->GetSignature(entity);
 		mEntityManager->SetSignature(clone, signature);
 		mSystemManager->EntitySignatureChanged(clone, signature);
+
+		Event event(Events::System::ENTITY);
+		event.SetParam(Events::System::Entity::CLONE, clone);
+		SendEvent(event);
 		return clone;
 	}
 	/*  _________________________________________________________________________ */
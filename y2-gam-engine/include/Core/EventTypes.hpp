@@ -66,6 +66,7 @@ namespace Events::System {
 namespace Events::System::Entity {
 
 	const EventId CREATE = "Events::System::Entity::CREATE"_hash;
+	const EventId CLONE = "Events::System::Entity::CLONE"_hash; //the copy, its components already added
 #undef DELETE
 	const EventId DELETE = "Events::System::Entity::DELETE"_hash;
 #define DELETE                           (0x00010000L)
@@ -74,8 +75,14 @@ namespace Events::System::Entity {
 }
 
 namespace Events::Physics {
-	const EventId COLLISION = "Events::Physics::COLLISION"_hash;
+	//state changes only, steady contacts send nothing.
+	//the solver reads CollisionSystem::GetArbiters instead of events
+	const EventId CONTACT_BEGIN = "Events::Physics::CONTACT_BEGIN"_hash;
+	const EventId CONTACT_END = "Events::Physics::CONTACT_END"_hash;
+	const EventId TRIGGER_BEGIN = "Events::Physics::TRIGGER_BEGIN"_hash;
+	const EventId TRIGGER_END = "Events::Physics::TRIGGER_END"_hash;
 }
-namespace Events::Physics::Collision {
-	const ParamId COLLIDED = "Events::Physics::Collision::COLLIDED"_hash;
+namespace Events::Physics::Pair {
+	//std::pair<Entity, Entity>, lower id first
+	const ParamId ENTITIES = "Events::Physics::Pair::ENTITIES"_hash;
 }
\ No newline at end of file
@@ -25,7 +25,9 @@ namespace Physics {
     constexpr float PI{ 3.14159265358979323846f };
     enum class Axis { FACE_A_X, FACE_A_Y, FACE_B_X, FACE_B_Y };
 
-    enum class EdgeNumbers {
+    //one byte each so the 4 edges fit exactly in FeaturePair::value,
+    //polygons number their edges past EDGE4
+    enum class EdgeNumbers : uint8_t {
         NO_EDGE = 0, EDGE1, EDGE2, EDGE3, EDGE4
 
     };
@@ -58,9 +60,11 @@ namespace Physics {
         float bias{};
         FeaturePair feature{};
     };
+    //b1 is the lower entity, the solver runs the arbiters in this order
     struct ArbiterKey {
         Entity b1{};
         Entity b2{};
+        bool operator<(ArbiterKey const& rhs) const { return b1 < rhs.b1 || (b1 == rhs.b1 && b2 < rhs.b2); }
     };
     struct Arbiter {
         Entity b1{};
@@ -73,7 +77,4 @@ namespace Physics {
         uint32_t contactsCount{};
     };
 
-    using ArbiterHashTable = std::unordered_map<size_t, Arbiter>;
-    using ArbiterPair = std::pair<size_t, Arbiter>;
-
 }
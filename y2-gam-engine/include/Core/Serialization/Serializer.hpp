@@ -11,6 +11,7 @@
 #include <Components/Camera.hpp>
 #include <Components/Editor.hpp>
 #include <Components/Gravity.hpp>
+#include <Components/Joint.hpp>
 #include <Components/OrthoCamera.hpp>
 #include <Components/RigidBody.hpp>
 #include <Components/Script.hpp>
@@ -32,6 +33,9 @@ Coordinator::GetInstance()->AddComponent(entity, Editor{ obj });
 static void EntityAddGravity(Entity const& entity, rapidjson::Value const& obj) {
 Coordinator::GetInstance()->AddComponent(entity, Gravity{ obj });
 }
+static void EntityAddJoint(Entity const& entity, rapidjson::Value const& obj) {
+Coordinator::GetInstance()->AddComponent(entity, Joint{ obj });
+}
 static void EntityAddOrthoCamera(Entity const& entity, rapidjson::Value const& obj) {
 Coordinator::GetInstance()->AddComponent(entity, OrthoCamera{ obj });
 }
@@ -53,6 +57,7 @@ else if constexpr (std::is_same_v<_type, BoxCollider>) return "BoxCollider";
 else if constexpr (std::is_same_v<_type, Camera>) return "Camera";
 else if constexpr (std::is_same_v<_type, Editor>) return "Editor";
 else if constexpr (std::is_same_v<_type, Gravity>) return "Gravity";
+else if constexpr (std::is_same_v<_type, Joint>) return "Joint";
 else if constexpr (std::is_same_v<_type, OrthoCamera>) return "OrthoCamera";
 else if constexpr (std::is_same_v<_type, RigidBody>) return "RigidBody";
 else if constexpr (std::is_same_v<_type, Script>) return "Script";
@@ -96,6 +101,13 @@ bool res = Coordinator::GetInstance()->GetComponent<Gravity>(entity).Serialize(o
 if (res) { SerializationManager::GetInstance()->InsertValue(ent, TypeToString<Gravity>(), obj); }
 else { obj.SetNull(); }
 }
+if (Coordinator::GetInstance()->HasComponent<Joint>(entity)){
+JSONObj obj{ JSON_OBJ_TYPE };
+obj.SetObject();
+bool res = Coordinator::GetInstance()->GetComponent<Joint>(entity).Serialize(obj);
+if (res) { SerializationManager::GetInstance()->InsertValue(ent, TypeToString<Joint>(), obj); }
+else { obj.SetNull(); }
+}
 if (Coordinator::GetInstance()->HasComponent<OrthoCamera>(entity)){
 JSONObj obj{ JSON_OBJ_TYPE };
 obj.SetObject();
@@ -138,6 +150,7 @@ static const std::map<std::string, std::function<void(Entity const&, rapidjson::
 {"Camera", EntityAddCamera},
 {"Editor", EntityAddEditor},
 {"Gravity", EntityAddGravity},
+{"Joint", EntityAddJoint},
 {"OrthoCamera", EntityAddOrthoCamera},
 {"RigidBody", EntityAddRigidBody},
 {"Script", EntityAddScript},
@@ -23,6 +23,7 @@
 #include "Math/MathUtils.h"
 #include <vector>
 #include <memory>
+#include <algorithm>
 #include <Core/Types.hpp>
 #include <set>
 #include <Core/Globals.hpp>
@@ -156,6 +157,9 @@ Checks if an object is contained within the current node's rectangle.
 		bool ContainRect(const Rect& rect) const {
 			return mRect.ContainRect(rect);
 		}
+		bool IntersectRect(const Rect& rect) const {
+			return mRect.IntersectRect(rect);
+		}
 		//void set_color(const Color &c);
 
 	public:
@@ -228,8 +232,10 @@ Checks if an object is contained within the current node's rectangle.
 
 @return none.
 
-Retrieves all objects that intersect with the provided rectangle and
-stores them in the provided container.
+Retrieves all objects in the leaves that intersect with the provided
+rectangle and stores them in the provided container. An object spanning
+several leaves is added once per leaf, the caller is expected to dedupe
+and do the exact box test.
 */
 	  void Retrieve(vec<T> &cont, const Rect &rect) const {
 		  //----------------------------------------------------------------
@@ -241,10 +247,10 @@ stores them in the provided container.
 		  if (mSubnode[0] != nullptr)  // [1]
 		  {
 			  // Continue down the tree
-			  if (mSubnode[0]->ContainRect(rect)) mSubnode[0]->Retrieve(cont, rect);
-			  if (mSubnode[1]->ContainRect(rect)) mSubnode[1]->Retrieve(cont, rect);
-			  if (mSubnode[2]->ContainRect(rect)) mSubnode[2]->Retrieve(cont, rect);
-			  if (mSubnode[3]->ContainRect(rect)) mSubnode[3]->Retrieve(cont, rect);
+			  if (mSubnode[0]->IntersectRect(rect)) mSubnode[0]->Retrieve(cont, rect);
+			  if (mSubnode[1]->IntersectRect(rect)) mSubnode[1]->Retrieve(cont, rect);
+			  if (mSubnode[2]->IntersectRect(rect)) mSubnode[2]->Retrieve(cont, rect);
+			  if (mSubnode[3]->IntersectRect(rect)) mSubnode[3]->Retrieve(cont, rect);
 
 			  return;
 		  }
@@ -252,6 +258,42 @@ stores them in the provided container.
 		  // Add all indexes to our container
 		  for (const auto& index : mIndex) cont.emplace_back(index);
 	  }
+	  /*  _________________________________________________________________________ */
+/*! Raycast
+
+@param origin Start of the segment.
+@param dir Segment direction, the end point is origin + dir.
+@param tMax Furthest fraction along the segment to visit, the visitor may
+shrink it to stop the walk early.
+@param visit Called as visit(leafObjects, tMax) for each non-empty leaf hit.
+
+@return none.
+
+Visits the leaves crossed by the segment front to back, skipping every
+node that starts past tMax.
+*/
+	  template <typename _visit>
+	  void Raycast(Vec2 const& origin, Vec2 const& dir, float& tMax, _visit visit) const {
+		  float tEnter{};
+		  if (!mRect.IntersectRay(origin, dir, tMax, tEnter)) return;
+
+		  if (mSubnode[0] == nullptr) {
+			  if (mIndex.size() != 0) visit(mIndex, tMax);
+			  return;
+		  }
+
+		  //order the children by entry time so the nearest leaves are visited first
+		  std::pair<float, int> order[4];
+		  int count{};
+		  for (int i{}; i < 4; ++i) {
+			  if (mSubnode[i]->mRect.IntersectRay(origin, dir, tMax, tEnter)) order[count++] = { tEnter, i };
+		  }
+		  std::sort(order, order + count);
+		  for (int i{}; i < count; ++i) {
+			  if (order[i].first > tMax) break;
+			  mSubnode[order[i].second]->Raycast(origin, dir, tMax, visit);
+		  }
+	  }
 	  void Debug() const {
 		  //----------------------------------------------------------------
 		  // [1] Draw this nodes boundaries.
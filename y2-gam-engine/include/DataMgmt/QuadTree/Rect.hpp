@@ -79,6 +79,32 @@ namespace DataMgmt {
 
 			return false;
 		}
+		bool IntersectRect(const Rect& r) const {
+			Vec2 rmin = r.GetMin();
+			Vec2 rmax = r.GetMax();
+
+			//  basic square overlap check, touching edges do not count
+			return rmin.x < max.x && rmax.x > min.x && rmin.y < max.y && rmax.y > min.y;
+		}
+		//slab test of the segment origin + t * dir against this rect, t clipped to [0, tMax]
+		bool IntersectRay(const Vec2& origin, const Vec2& dir, float tMax, float& tEnter) const {
+			float t0{ 0.f }, t1{ tMax };
+			for (int i{}; i < 2; ++i) {
+				if (dir[i] == 0.f) {
+					//parallel to the slab, either always inside or never
+					if (origin[i] < min[i] || origin[i] > max[i]) return false;
+					continue;
+				}
+				float inv{ 1.f / dir[i] };
+				float tNear{ (min[i] - origin[i]) * inv }, tFar{ (max[i] - origin[i]) * inv };
+				if (tNear > tFar) std::swap(tNear, tFar);
+				t0 = std::max(t0, tNear);
+				t1 = std::min(t1, tFar);
+				if (t0 > t1) return false;
+			}
+			tEnter = t0;
+			return true;
+		}
 		bool ContainPos(const Vec2& v) const {
 			if (v.x < min.x || v.x > max.x) return false;
 			if (v.y < min.y || v.y > max.y) return false;
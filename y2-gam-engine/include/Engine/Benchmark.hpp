@@ -0,0 +1,36 @@
+#pragma once
+/******************************************************************************/
+/*!
+\par        Image Engine
+\file       Benchmark.hpp
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief		headless micro benchmarks, run with --bench before any window,
+			audio or mono setup. --determinism runs the physics replay check,
+			--bench physics runs the solver scenes and can write them as json
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+			or disclosure of this file or its contents without the prior
+			written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+
+namespace Benchmark {
+	bool Run(int argc, char* argv[], int& exitCode);
+	bool RunAABBBatch();
+	bool RunSpatialQueries();
+	bool RunContinuousCollision();
+	void RunPhysicsScenes(const char* jsonPath);
+	void RunMathKernels();
+	bool RunQuadVertices();
+	bool RunTextureSlots();
+	bool RunMappedRing();
+	bool RunRenderQueue();
+	bool RunSpriteCulling();
+	bool RunInstancing();
+	bool RunStaticBatches();
+	bool RunTextureAtlas();
+	bool RunDeterminism(int frames);
+}
@@ -0,0 +1,60 @@
+#pragma once
+/******************************************************************************/
+/*!
+\par        Image Engine
+\file       StubGL.hpp
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief		stand in gl for the benchmarks, so the renderer can run without
+			a window or context
+
+			Install points the glad functions the renderer uses at stubs
+			that hand out handles, always report success and record what
+			a frame asked for, the bound texture units, the buffer
+			contents, the texture uploads, the fences and the draws.
+			buffer storage is host memory, so a persistently mapped
+			buffer is written in place like on a gl 4.4 context. nothing
+			is rendered.
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+			or disclosure of this file or its contents without the prior
+			written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+
+namespace StubGL {
+	struct State {
+		int maxTexUnits{};
+		unsigned int nextHdl{ 1 };
+		std::vector<unsigned int> boundTextures; //texture handle per unit
+		std::unordered_map<unsigned int, std::vector<unsigned char>> bufferData; //contents per buffer handle, mapped buffers included
+		std::unordered_map<unsigned int, std::vector<unsigned char>> textureData; //rgba bytes of the last whole upload per texture handle
+		size_t drawCalls{};
+		size_t indicesDrawn{};
+		size_t lineDrawCalls{};
+		size_t fencesCreated{};
+		size_t fenceWaits{};
+
+		//what glVertexAttribPointer and glVertexAttribDivisor recorded per vertex array
+		struct Attrib {
+			unsigned int buffer;
+			size_t stride;
+			bool isPerInstance;
+		};
+		unsigned int boundArrayBuffer{};
+		unsigned int boundVertexArray{};
+		std::unordered_map<unsigned int, std::vector<Attrib>> vertexArrays;
+
+		//called on every indexed draw after it is counted, with the bytes of the bound
+		//vertex array's vertex buffer from the base vertex on and its index count
+		void (*onDraw)(State const& state, unsigned char const* vertices, size_t size, int idxCount) {};
+		//called on every instanced draw with the bytes of its instance buffer from
+		//instance 0 and the range of instances it reads
+		void (*onInstancedDraw)(State const& state, unsigned char const* instances, size_t size, int baseInstance, int instanceCount) {};
+	};
+
+	void Install(int maxTexUnits, bool hasBufferStorage = true);
+	State& GetState();
+}
@@ -29,10 +29,30 @@
 #include "Components/OrthoCamera.hpp"
 #include "Components/Transform.hpp"
 
+//why a batch was drawn
+enum class FlushReason {
+	INDICES, //quad batch full
+	TEXTURE_UNITS, //no free unit for the next texture
+	LINES, //line batch full
+	INSTANCED, //quads batched so far, drawn before instanced sprites
+	SCENE_END,
+	COUNT
+};
+
 struct Statistics {
 	unsigned int drawCalls{};
 	unsigned int quadCount{};
 	unsigned int lineCount{};
+	unsigned int visibleCount{}; //sprites left after culling
+	unsigned int culledCount{};
+	unsigned int staticQuadCount{}; //drawn from static batches, nothing uploaded
+	unsigned int staticBuilds{}; //static batches baked this frame
+	std::array<unsigned int, static_cast<size_t>(FlushReason::COUNT)> flushes{};
+	size_t uploadBytes{}; //vertex and instance bytes handed to the gpu, copied or written to the mapped ring
+	double vtxGenMs{}; //writing the vertices of DrawQuads or the instances of DrawQuadsInstanced
+	double submitMs{}; //uploads, binds and draw calls in FlushBatch, and waits on the mapped ring
+
+	unsigned int GetFlushCount(FlushReason reason) const { return flushes[static_cast<size_t>(reason)]; }
 
 	unsigned int GetTotalVtxCount() { return quadCount * 4; }
 	unsigned int GetTotalIdxCount() { return quadCount * 6; }
@@ -46,31 +66,97 @@ struct QuadVtx {
 	//TODO test if unsigned int works
 };
 
+//a quad for DrawQuads, no subtexture draws it flat colored
+struct QuadDraw {
+	Transform const* transform{};
+	SubTexture const* subtex{};
+	glm::vec4 color{};
+	float texIdx{}; //assigned by the renderer
+};
+
+//one sprite of the instanced path, the shader expands it over a static unit quad
+struct QuadInstance {
+	glm::vec3 pos;
+	glm::vec2 scale;
+	glm::vec2 cosSin; //cos and sin of the rotation, as cached by Transform
+	glm::vec4 texRect; //texture coordinates of the bottom left and top right corners
+	std::uint32_t clr; //rgba8, r in the lowest byte
+	float texIdx;
+};
+
+//instances drawn with the same textures bound, textures index into the list kept with the runs
+struct InstanceRun {
+	unsigned int first{};
+	unsigned int count{};
+	unsigned int firstTex{};
+	unsigned int texCount{};
+};
+
+//sprites baked once into their own instance buffer, drawn again every frame without uploading
+struct StaticBatch {
+	std::shared_ptr<VertexArray> vertexArray;
+	std::vector<InstanceRun> runs;
+	std::vector<std::shared_ptr<Texture>> textures;
+	unsigned int quadCount{};
+};
+
 struct LineVtx {
 	glm::vec3 pos;
 	glm::vec4 clr;
 };
 
+//the unit a texture handle is bound to, only valid while batch is the current batch
+struct TexSlot {
+	unsigned int batch{};
+	unsigned int unit{};
+};
+
 struct RendererData {
 
 	static const unsigned int cMaxQuads{ 20000 };
 	static const unsigned int cMaxVertices{ cMaxQuads * 4 };
 	static const unsigned int cMaxIndices{ cMaxQuads * 6 };
 	unsigned int maxTexUnits{}; //set actual number in init 
+	//DrawQuads only splits vertex generation over threads with at least this many quads each
+	static constexpr unsigned int cMinQuadsPerThread{ 1024 };
+	static constexpr unsigned int cMaxVtxThreads{ 8 };
+	unsigned int vtxThreadCount{ 1 }; //set actual number in init
 
 	std::shared_ptr<VertexArray> quadVertexArray;
 	std::shared_ptr<VertexBuffer> quadVertexBuffer;
 	std::shared_ptr<Shader> texShader;
 	std::shared_ptr<Texture> whiteTex;
 
+	//instanced sprites, a static unit quad plus one QuadInstance per sprite
+	std::shared_ptr<VertexArray> instanceVertexArray;
+	std::shared_ptr<VertexBuffer> instanceVertexBuffer;
+	std::shared_ptr<Shader> instanceShader;
+	std::vector<QuadInstance> instanceBuffer; //only without mapping
+	std::shared_ptr<VertexBuffer> unitQuadVertexBuffer; //shared with every static batch
+	std::shared_ptr<ElementBuffer> unitQuadElementBuffer;
+	BufferLayout instanceLayout;
+	std::vector<InstanceRun> instanceRuns;
+	std::vector<std::shared_ptr<Texture>> runTextures;
+
 	std::shared_ptr<VertexArray> lineVertexArray;
 	std::shared_ptr<VertexBuffer> lineVertexBuffer;
 	std::shared_ptr<Shader> lineShader;
 
 	unsigned int quadIdxCount{};
-	std::vector<QuadVtx> quadBuffer; // Dynamic buffer to hold vertex data for batching
+	std::vector<QuadVtx> quadBuffer; // Dynamic buffer to hold vertex data for batching, only without mapping
 	QuadVtx* quadBufferPtr{ nullptr }; // Pointer to the current position in the buffer
 
+	//ring of batches in one persistently mapped vbo, each batch is fenced after its draw
+	//so its segment is only written again once the gpu is done reading it
+	static constexpr unsigned int cVtxSegments{ 3 };
+	QuadVtx* quadMapped{ nullptr }; // start of the mapped vbo, null when falling back to SetData
+	unsigned int quadSegment{};
+	std::array<GLsync, cVtxSegments> quadFences{};
+	//instances stream through a ring of their own, one chunk per segment
+	QuadInstance* instanceMapped{ nullptr };
+	unsigned int instanceSegment{};
+	std::array<GLsync, cVtxSegments> instanceFences{};
+
 	unsigned int lineVtxCount{};
 	std::vector<LineVtx> lineBuffer;
 	LineVtx* lineBufferPtr{ nullptr };
@@ -79,6 +165,9 @@ struct RendererData {
 
 	std::vector<std::shared_ptr<Texture>> texUnits; //pointer to an array of Texture pointers (may change to vector)
 	unsigned int texUnitIdx{ 1 }; // 0 = white tex
+	//indexed by gl texture handle, bumping texBatch clears every entry at once
+	std::vector<TexSlot> texSlots;
+	unsigned int texBatch{ 1 };
 
 	Statistics stats;
 };
@@ -86,7 +175,7 @@ struct RendererData {
 class Renderer {
 public:
 
-	static void Init();
+	static void Init(bool usePersistentMapping = true);
 	static void Shutdown();
 
 	static void RenderSceneBegin(OrthoCamera const& camera);
@@ -95,41 +184,66 @@ public:
 	static unsigned int GetMaxTextureUnits();
 
 	//Quads
-	//TODO overload transform parameter
 	static void DrawQuad(glm::vec3 const& pos, glm::vec2 const& scale, glm::vec4 const& clr, float rot = 0.f);
+	static void DrawQuad(Transform const& transform, glm::vec4 const& clr);
+	static void DrawQuad(glm::mat4 const& transformMtx, glm::vec4 const& clr);
 
 	//TODO add tint 
 	static void DrawQuad(glm::vec3 const& pos, glm::vec2 const& scale,
 		std::shared_ptr<Texture>const& tex, float rot = 0.f);
 
 	static void DrawSprite(glm::vec3 const& pos, glm::vec2 const& scale, std::shared_ptr<SubTexture>const& subtex, glm::vec4 const& tint = {1.f,1.f,1.f,1.f}, float rot = 0.f);
+	static void DrawSprite(glm::mat4 const& transformMtx, std::shared_ptr<SubTexture> const& subtex, glm::vec4 const& tint = { 1.f,1.f,1.f,1.f });
 
 	static void DrawSprite(Transform const& transform, std::shared_ptr<SubTexture> const& subtex, glm::vec4 const& tint = { 1.f,1.f,1.f,1.f });
+	static void DrawQuads(std::vector<QuadDraw>& draws);
+	static void DrawQuadsInstanced(std::vector<QuadDraw>& draws);
+	static void BuildStaticBatch(std::vector<QuadDraw>& draws, StaticBatch& batch);
+	static void DrawStaticBatch(StaticBatch const& batch);
 	
 	//Lines
 	static void DrawLine(glm::vec3 const& p0, glm::vec3 const& p1, glm::vec4 const& clr);
 	static void DrawLineRect(glm::vec3 const& pos, glm::vec2 const& scale, glm::vec4 const& clr);
 
 	static void FlushBatch();
+
+	//2D quad vertices without a matrix, no gl calls so it also runs without a context
+	static QuadVtx* WriteQuadVertices(QuadVtx* out, glm::vec3 const& pos, glm::vec2 const& scale,
+		glm::vec2 const& cosSin, glm::vec4 const& clr, glm::vec2 const* texCoords, float texIdx);
+	static void WriteQuadDrawVertices(QuadDraw const* draws, size_t count, QuadVtx* out, unsigned int threadCount);
+	static void WriteQuadInstances(QuadDraw const* draws, size_t count, QuadInstance* out, unsigned int threadCount);
 private:
+	static void DrawInstanceChunk(QuadDraw* draws, size_t count);
+	static void SplitInstanceRuns(QuadDraw* draws, size_t count, std::vector<InstanceRun>& runs,
+		std::vector<std::shared_ptr<Texture>>& textures);
+	static void DrawInstanceRuns(std::shared_ptr<VertexArray> const& vao, std::vector<InstanceRun> const& runs,
+		std::vector<std::shared_ptr<Texture>> const& textures, unsigned int baseInstance = 0);
+	static void SubmitQuad(glm::vec3 const& pos, glm::vec2 const& scale, glm::vec2 const& cosSin,
+		glm::vec4 const& clr, glm::vec2 const* texCoords, float texIdx);
+	static bool TryGetTexIdx(std::shared_ptr<Texture> const& tex, float& texIdx);
+	static float GetTexIdx(std::shared_ptr<Texture> const& tex);
 	static void SetQuadBufferData(const glm::vec3& pos, const glm::vec2& scale,
 		const glm::vec4& clr, const glm::vec2& texCoord,
 		float texIdx);
 	static void SetLineBufferData(glm::vec3 const& pos, glm::vec4 const& clr);
+	static QuadVtx* GetBatchStart();
+	static void WaitForSegment(GLsync& fence);
 	static void BeginBatch();
-	static void NextBatch();
+	static void NextBatch(FlushReason reason);
 public:
 	//OpenGL Render Commands
 	static void SetClearColor(glm::vec4 const& color);
 	static void ClearColor();
 	static void ClearDepth();
-	static void DrawIndexed(std::shared_ptr<VertexArray> const& vertexArray, unsigned int idxCount = 0);
+	static void DrawIndexed(std::shared_ptr<VertexArray> const& vertexArray, unsigned int idxCount = 0, int baseVtx = 0);
+	static void DrawIndexedInstanced(std::shared_ptr<VertexArray> const& vao, unsigned int instanceCount, unsigned int baseInstance = 0);
 	static void DrawLineArray(std::shared_ptr<VertexArray> const& vao, unsigned int vtxCount);
 
 	//Stats
 
 	static Statistics GetStats();
 	static void ResetStats();
+	static void AddCullCounts(unsigned int visible, unsigned int culled);
 
 private:
 	static RendererData mData;
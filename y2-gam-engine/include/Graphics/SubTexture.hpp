@@ -26,10 +26,11 @@ class SubTexture {
 public:
 	SubTexture(std::shared_ptr<Texture> const& tex, glm::vec2 const& min, glm::vec2 const& max);
 
-	std::shared_ptr<Texture> const GetTexture() const;
+	std::shared_ptr<Texture> const& GetTexture() const;
 	glm::vec2 const* GetTexCoords() const;
 
 	static std::shared_ptr<SubTexture> Create(std::shared_ptr<Texture> const& tex, glm::vec2 const& idxCoord, glm::vec2 const& size);
+	static std::shared_ptr<SubTexture> Create(std::string const& path, unsigned int id);
 private:
 	std::shared_ptr<Texture> mTex;
 	glm::vec2 mTexCoords[4];
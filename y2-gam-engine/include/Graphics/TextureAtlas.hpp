@@ -0,0 +1,54 @@
+#pragma once
+/******************************************************************************/
+/*!
+\par        Image Engine
+\file       TextureAtlas.hpp
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief		packs the sprites listed in data/assets.json into a few atlas
+			textures at startup
+
+			every sprite of every sheet is cut out, packed with the
+			skyline packer and copied into a page with its edge pixels
+			repeated into the padding, so filtering never picks up a
+			neighbour. the table maps a sheet path and sprite id to the
+			page and uvs it landed on, SubTexture::Create reads it, so
+			sprites from different sheets share a texture and a batch.
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+			or disclosure of this file or its contents without the prior
+			written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+
+#include "Graphics/Texture.hpp"
+
+class TextureAtlas {
+public:
+	struct Region {
+		std::shared_ptr<Texture> texture; //the page
+		glm::vec2 min;
+		glm::vec2 max;
+	};
+
+	static constexpr unsigned int cMaxPageSize{ 4096 };
+	static constexpr unsigned int cPadding{ 1 }; //edge pixels repeated around every sprite
+
+	static std::shared_ptr<TextureAtlas> GetInstance() {
+		if (!_mSelf) return _mSelf = std::make_shared<TextureAtlas>();
+		return _mSelf;
+	}
+
+	void Init(std::string const& name);
+
+	Region const& GetRegion(std::string const& path, unsigned int id) const;
+	std::unordered_map<std::string, std::vector<Region>> const& GetRegions() const { return mRegions; }
+	std::vector<std::shared_ptr<Texture>> const& GetPages() const { return mPages; }
+
+private:
+	static std::shared_ptr<TextureAtlas> _mSelf;
+	std::vector<std::shared_ptr<Texture>> mPages;
+	std::unordered_map<std::string, std::vector<Region>> mRegions; //by sheet path, then sprite id
+};
@@ -34,7 +34,7 @@ public:
 	void Bind() const;
 	void Unbind() const;
 
-	void AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vbo);
+	void AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vbo, bool isPerInstance = false);
 	void SetElementBuffer(const std::shared_ptr<ElementBuffer>& ebo);
 
 	std::vector<std::shared_ptr<VertexBuffer>> const& GetVertexBuffers() const { return mVbos; }
@@ -42,6 +42,7 @@ public:
 
 private:
 	unsigned int vaoHdl;
+	unsigned int mAttribCount{}; //attributes of the vbos added so far, the next vbo starts after them
 	std::vector<std::shared_ptr<VertexBuffer>> mVbos;
 	std::shared_ptr<ElementBuffer> mEbo;
 };
\ No newline at end of file
@@ -32,7 +32,8 @@ enum class AttributeType {
 	IVEC2,
 	IVEC3,
 	IVEC4,
-	BOOL
+	BOOL,
+	UBYTE4 //e.g. an rgba8 color, set isNormalized to read it as 0 to 1
 };
 
 static unsigned int AttributeTypeSize(AttributeType type)
@@ -49,6 +50,7 @@ static unsigned int AttributeTypeSize(AttributeType type)
 	case AttributeType::IVEC3:	return 4 * 3;
 	case AttributeType::IVEC4:	return 4 * 4;
 	case AttributeType::BOOL:	return 1;
+	case AttributeType::UBYTE4:	return 4;
 	}
 
 	std::cout << "ERROR: Unknown AttributeType!\n";
@@ -103,6 +105,7 @@ This function returns the number of components based on the attribute type.
 		case AttributeType::IVEC3:	return 3;
 		case AttributeType::IVEC4:	return 4;
 		case AttributeType::BOOL:	return 1;
+		case AttributeType::UBYTE4:	return 4;
 		}
 
 		std::cout << "ERROR: Unknown AttributeType!\n";
@@ -143,12 +146,13 @@ private:
 #pragma once
 class VertexBuffer {
 public:
-	VertexBuffer(unsigned int size);
+	VertexBuffer(unsigned int size, bool isPersistentMapped = false);
 	VertexBuffer(float* vertices, unsigned int size);
 	~VertexBuffer();
 
 	static std::shared_ptr<VertexBuffer> Create(unsigned int size);
 	static std::shared_ptr<VertexBuffer> Create(float* vertices, unsigned int size);
+	static std::shared_ptr<VertexBuffer> CreateMapped(unsigned int size);
 
 	void Bind() const;
 	void Unbind() const;
@@ -157,8 +161,11 @@ public:
 	void SetLayout(BufferLayout& layout);
 
 	void SetData(void* const data, unsigned int size);
+	//cpu address of a persistently mapped buffer, null otherwise
+	void* GetMappedData() const { return mMappedData; }
 
 private:
 	unsigned int mVboHdl;
 	BufferLayout mLayout;
+	void* mMappedData{ nullptr };
 };
\ No newline at end of file
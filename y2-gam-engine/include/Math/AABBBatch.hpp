@@ -0,0 +1,82 @@
+#pragma once
+/******************************************************************************/
+/*!
+\par        Image Engine
+\file       AABBBatch.hpp
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief		batched aabb overlap kernel (scalar/sse/avx2) over soa blocks
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+			or disclosure of this file or its contents without the prior
+			written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+
+#include "Math/MathUtils.h"
+#include <cstdint>
+#include <vector>
+
+namespace Collision {
+	//instruction set used by the batch kernel
+	enum class SimdIsa { SCALAR, SSE, AVX2 };
+
+	//structure of arrays of aabbs, one float lane per box
+	struct AABBSoA {
+		std::vector<float> minX, minY, maxX, maxY;
+
+		/*  _________________________________________________________________________ */
+		/*! Clear
+
+		@return none.
+
+		Removes all boxes while keeping the allocated storage.
+		*/
+		void Clear() {
+			minX.clear(); minY.clear();
+			maxX.clear(); maxY.clear();
+		}
+		/*  _________________________________________________________________________ */
+		/*! Reserve
+
+		@param n The number of boxes to reserve storage for.
+
+		@return none.
+
+		Reserves storage for n boxes in every lane.
+		*/
+		void Reserve(size_t n) {
+			minX.reserve(n); minY.reserve(n);
+			maxX.reserve(n); maxY.reserve(n);
+		}
+		/*  _________________________________________________________________________ */
+		/*! Push
+
+		@param min The minimum corner of the box.
+		@param max The maximum corner of the box.
+
+		@return none.
+
+		Appends a box to the end of the block.
+		*/
+		void Push(Vec2 const& min, Vec2 const& max) {
+			minX.push_back(min.x); minY.push_back(min.y);
+			maxX.push_back(max.x); maxY.push_back(max.y);
+		}
+		size_t Size() const { return minX.size(); }
+	};
+
+	//number of 32 bit mask words needed to hold count hit bits
+	constexpr size_t AABBMaskWords(size_t count) { return (count + 31) / 32; }
+
+	SimdIsa GetBestSimdIsa();
+	bool IsSimdIsaSupported(SimdIsa isa);
+	const char* GetSimdIsaName(SimdIsa isa);
+
+	size_t OverlapBatch(Vec2 const& qmin, Vec2 const& qmax, AABBSoA const& soa,
+		size_t first, size_t count, uint32_t* mask);
+	size_t OverlapBatch(SimdIsa isa, Vec2 const& qmin, Vec2 const& qmax, AABBSoA const& soa,
+		size_t first, size_t count, uint32_t* mask);
+}
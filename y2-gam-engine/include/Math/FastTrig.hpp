@@ -0,0 +1,84 @@
+#pragma once
+/******************************************************************************/
+/*!
+\par        Image Engine
+\file       FastTrig.hpp
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief		polynomial sin/cos, one angle at a time or a batch at a time
+
+			the angle is reduced to [-pi/4, pi/4] around the nearest
+			multiple of pi/2 and both polynomials are evaluated there,
+			error is within a couple of ulp of sinf/cosf. the batch path
+			does the same operations in the same order 4 lanes at a
+			time, so both paths give the same bits on every platform.
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+			or disclosure of this file or its contents without the prior
+			written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+
+#include <math.h>
+#include <cstddef>
+
+namespace Image {
+	namespace FastTrig {
+		//pi/2 split so the first two products are exact for the angles we reduce
+		constexpr float PIO2_1{ 1.5703125f };
+		constexpr float PIO2_2{ 4.837512969970703125e-4f };
+		constexpr float PIO2_3{ 7.54978995489188216e-8f };
+		constexpr float TWO_OVER_PI{ 0.636619772367581343f };
+		//adding and taking away 1.5 * 2^23 rounds to the nearest integer
+		constexpr float ROUND_MAGIC{ 12582912.f };
+		//past this the reduction loses precision, those angles go to sinf/cosf
+		constexpr float MAX_ANGLE{ 65536.f };
+
+		constexpr float SIN_1{ -1.6666654611e-1f };
+		constexpr float SIN_2{ 8.3321608736e-3f };
+		constexpr float SIN_3{ -1.9515295891e-4f };
+		constexpr float COS_1{ 4.166664568298827e-2f };
+		constexpr float COS_2{ -1.388731625493765e-3f };
+		constexpr float COS_3{ 2.443315711809948e-5f };
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! SinCos
+
+	@param angle The angle in radians.
+	@param sine Set to the sine of the angle.
+	@param cosine Set to the cosine of the angle.
+
+	@return none.
+
+	Scalar path, gives the same bits as SinCosBatch for the same angle.
+	*/
+	inline void SinCos(float angle, float& sine, float& cosine) {
+		using namespace FastTrig;
+		if (!(fabsf(angle) <= MAX_ANGLE)) {
+			sine = sinf(angle);
+			cosine = cosf(angle);
+			return;
+		}
+		float j{ angle * TWO_OVER_PI + ROUND_MAGIC };
+		j = j - ROUND_MAGIC;
+		int quadrant{ static_cast<int>(j) };
+		float r{ angle - j * PIO2_1 };
+		r = r - j * PIO2_2;
+		r = r - j * PIO2_3;
+
+		float z{ r * r };
+		float s{ ((SIN_3 * z + SIN_2) * z + SIN_1) * z * r + r };
+		float c{ ((COS_3 * z + COS_2) * z + COS_1) * z * z - 0.5f * z + 1.f };
+
+		if (quadrant & 1) {
+			float t{ s }; s = c; c = t;
+		}
+		sine = (quadrant & 2) ? -s : s;
+		cosine = ((quadrant + 1) & 2) ? -c : c;
+	}
+
+	void SinCosBatch(float const* angles, float* sines, float* cosines, size_t count);
+}
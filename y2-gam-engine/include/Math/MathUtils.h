@@ -9,7 +9,9 @@
 \brief      Header file for addition math function
 
 			This file contains additional math functions. The functions
-			includes degree and radian.
+			includes degree and radian. The whole math library is defined
+			in its headers so the physics inner loops can inline it
+			without link time code generation.
 
 \copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
 			or disclosure of this file or its contents without the prior
@@ -18,6 +20,41 @@
 /******************************************************************************/
 #pragma once
 #include <math.h>
+
+namespace Image {
+	constexpr float gPI{ 3.141592653589793238462643383279502884197169399375105f };
+
+	/*  _________________________________________________________________________ */
+	/*! Degree
+
+	@param rad
+	Radian to convert
+
+	@return float.
+	Degree after conversion
+
+	This function is responsible for converting radian to degree
+	*/
+	[[nodiscard]] inline constexpr float Degree(float rad) {
+		return rad * (180.f / gPI);
+	}
+	/*  _________________________________________________________________________ */
+	/*! Radian
+
+	@param degree
+	Degree to convert
+
+	@return float.
+	Radian after conversion
+
+	This function is responsible for converting degree to radian
+	*/
+	[[nodiscard]] inline constexpr float Radian(float degree) {
+		return degree * (gPI / 180.f);
+	}
+}
+
+//after gPI, the matrix headers include this one for it
 #include "Vec2.h"
 #include "Vec3.h"
 #include "Vec4.h"
@@ -26,10 +63,3 @@
 #include "Mat4.h"
 
 using namespace Image;
-namespace Image {
-	constexpr float gPI{ 3.141592653589793238462643383279502884197169399375105f };
-
-	float Degree(float rad);
-
-	float Radian(float degree);
-}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+/******************************************************************************/
+/*!
+\par        Image Engine
+\file       Narrowphase.hpp
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief		contact kernels for the non box collider shapes
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+			or disclosure of this file or its contents without the prior
+			written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+
+#include "Math/MathUtils.h"
+#include <Core/Physics.hpp>
+#include <Components/RigidBody.hpp>
+#include <Components/BoxCollider.hpp>
+#include <vector>
+
+namespace Collision {
+	//every kernel writes up to MAX_CONTACT_POINTS contacts with the normal
+	//pointing from b1 to b2 and returns the count
+	using CollideFn = uint32_t(*)(Physics::Contact* contacts, RigidBody const& b1, BoxCollider const& c1,
+		RigidBody const& b2, BoxCollider const& c2);
+
+	//convex core in world space, the shape is the core grown by radius
+	struct Hull {
+		Vec2 vertices[MAX_POLYGON_VERTICES]{};
+		Vec2 normals[MAX_POLYGON_VERTICES]{};
+		uint32_t count{};
+		float radius{};
+	};
+	Hull MakeHull(RigidBody const& rb, BoxCollider const& collider);
+
+	int ClipSegmentToLine(Physics::ClipVertex vOut[2], Physics::ClipVertex vIn[2], const Vec2& normal, float offset,
+		float clipEdge);
+
+	//box pairs for the batched face test, one lane per pair
+	struct BoxPairSoA {
+		std::vector<float> dx, dy;
+		std::vector<float> h1x, h1y, h2x, h2y;
+		std::vector<float> c1, s1, c2, s2;
+
+		/*  _________________________________________________________________________ */
+		/*! Clear
+
+		@return none.
+
+		Removes all pairs while keeping the allocated storage.
+		*/
+		void Clear() {
+			dx.clear(); dy.clear();
+			h1x.clear(); h1y.clear(); h2x.clear(); h2y.clear();
+			c1.clear(); s1.clear(); c2.clear(); s2.clear();
+		}
+		/*  _________________________________________________________________________ */
+		/*! Push
+
+		@param d Position of the second box minus the first.
+		@param h1 Half extents of the first box.
+		@param rot1 Rotation of the first box.
+		@param h2 Half extents of the second box.
+		@param rot2 Rotation of the second box.
+
+		@return none.
+
+		Appends a pair to the end of the block.
+		*/
+		void Push(Vec2 const& d, Vec2 const& h1, Mat22 const& rot1, Vec2 const& h2, Mat22 const& rot2) {
+			dx.push_back(d.x); dy.push_back(d.y);
+			h1x.push_back(h1.x); h1y.push_back(h1.y);
+			h2x.push_back(h2.x); h2y.push_back(h2.y);
+			c1.push_back(rot1.mMat[0].x); s1.push_back(rot1.mMat[0].y);
+			c2.push_back(rot2.mMat[0].x); s2.push_back(rot2.mMat[0].y);
+		}
+		size_t Size() const { return dx.size(); }
+	};
+	size_t BoxFaceTestBatch(BoxPairSoA const& soa, uint32_t* mask);
+
+	uint32_t CollideCircles(Physics::Contact* contacts, RigidBody const& b1, BoxCollider const& c1,
+		RigidBody const& b2, BoxCollider const& c2);
+	uint32_t CollideBoxCircle(Physics::Contact* contacts, RigidBody const& b1, BoxCollider const& c1,
+		RigidBody const& b2, BoxCollider const& c2);
+	uint32_t CollideHullCircle(Physics::Contact* contacts, RigidBody const& b1, BoxCollider const& c1,
+		RigidBody const& b2, BoxCollider const& c2);
+	uint32_t CollideHulls(Physics::Contact* contacts, RigidBody const& b1, BoxCollider const& c1,
+		RigidBody const& b2, BoxCollider const& c2);
+}
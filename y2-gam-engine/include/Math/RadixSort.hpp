@@ -0,0 +1,78 @@
+#pragma once
+/******************************************************************************/
+/*!
+\par        Image Engine
+\file       RadixSort.hpp
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief		lsd radix sort of 64 bit keys that carry an index back to what
+			they were made from
+
+			one pass per byte, lowest byte first. the counts for every
+			byte are taken in a single read of the keys, and a byte that
+			is the same in every key is skipped, so keys that only use a
+			few of their bits only pay for those. stable, equal keys keep
+			their order.
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+			or disclosure of this file or its contents without the prior
+			written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Image {
+	struct KeyIndex {
+		std::uint64_t key;
+		std::uint32_t index;
+	};
+
+	/*  _________________________________________________________________________ */
+	/*! RadixSort
+
+	@param items The keys to sort, sorted by key on return.
+	@param scratch Working space, resized to items. Kept by the caller so
+	it is not allocated every call.
+
+	@return none.
+
+	Sorts the keys in ascending order in O(n), keeping the order of equal
+	keys.
+	*/
+	inline void RadixSort(std::vector<KeyIndex>& items, std::vector<KeyIndex>& scratch) {
+		size_t const count{ items.size() };
+		if (count < 2) return;
+		scratch.resize(count);
+
+		std::array<std::array<std::uint32_t, 256>, 8> counts{};
+		for (auto const& item : items) {
+			for (unsigned int b{}; b < 8; ++b) ++counts[b][(item.key >> (b * 8)) & 0xFF];
+		}
+
+		KeyIndex* src{ items.data() };
+		KeyIndex* dst{ scratch.data() };
+		for (unsigned int b{}; b < 8; ++b) {
+			auto& offsets{ counts[b] };
+			//every key has the same byte here, the pass would not move anything
+			if (offsets[(src[0].key >> (b * 8)) & 0xFF] == count) continue;
+
+			std::uint32_t sum{};
+			for (auto& offset : offsets) {
+				std::uint32_t bucket{ offset };
+				offset = sum;
+				sum += bucket;
+			}
+			for (size_t i{}; i < count; ++i) {
+				dst[offsets[(src[i].key >> (b * 8)) & 0xFF]++] = src[i];
+			}
+			std::swap(src, dst);
+		}
+		if (src != items.data()) items.swap(scratch);
+	}
+}
@@ -0,0 +1,120 @@
+#pragma once
+/******************************************************************************/
+/*!
+\par        Image Engine
+\file       SkylinePacker.hpp
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief		skyline rectangle packer for building texture atlases
+
+			the packed area is tracked as a skyline, the top edge of
+			what has been placed so far as a list of horizontal
+			segments. a rect goes where its top ends up lowest, ties go
+			to the narrower segment so wide gaps are kept for wide
+			rects. feeding the rects tallest first packs best.
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+			or disclosure of this file or its contents without the prior
+			written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+namespace Image {
+	struct PackRect {
+		unsigned int x, y, w, h;
+	};
+
+	class SkylinePacker {
+	public:
+		/*  _________________________________________________________________________ */
+		/*! SkylinePacker
+
+		@param width The width of the area to pack into.
+		@param height The height of the area to pack into.
+		*/
+		SkylinePacker(unsigned int width, unsigned int height)
+			: mWidth{ width }, mHeight{ height }, mSkyline{ Segment{ 0, 0, width } } {}
+
+		/*  _________________________________________________________________________ */
+		/*! Insert
+
+		@param w The width of the rect.
+		@param h The height of the rect.
+		@param out Where the rect was placed, only written when it fits.
+
+		@return true if the rect fit in the area.
+		*/
+		bool Insert(unsigned int w, unsigned int h, PackRect& out) {
+			size_t best{ mSkyline.size() };
+			unsigned int bestY{}, bestTop{ ~0u }, bestSegWidth{ ~0u };
+			for (size_t i{}; i < mSkyline.size(); ++i) {
+				Segment const& seg{ mSkyline[i] };
+				if (seg.x + w > mWidth) break;
+
+				//the rect sits on the highest segment under it
+				unsigned int y{};
+				unsigned int left{ w };
+				for (size_t j{ i }; j < mSkyline.size(); ++j) {
+					y = std::max(y, mSkyline[j].y);
+					if (mSkyline[j].w >= left) break;
+					left -= mSkyline[j].w;
+				}
+				if (y + h > mHeight) continue;
+				if (y + h < bestTop || (y + h == bestTop && seg.w < bestSegWidth)) {
+					best = i;
+					bestY = y;
+					bestTop = y + h;
+					bestSegWidth = seg.w;
+				}
+			}
+			if (best == mSkyline.size()) return false;
+
+			out = PackRect{ mSkyline[best].x, bestY, w, h };
+			mSkyline.insert(mSkyline.begin() + best, Segment{ out.x, bestY + h, w });
+
+			//cut the segments the rect now covers
+			unsigned int right{ out.x + w };
+			for (size_t i{ best + 1 }; i < mSkyline.size();) {
+				Segment& seg{ mSkyline[i] };
+				if (seg.x >= right) break;
+				unsigned int covered{ right - seg.x };
+				if (seg.w <= covered) {
+					mSkyline.erase(mSkyline.begin() + i);
+					continue;
+				}
+				seg.x += covered;
+				seg.w -= covered;
+				break;
+			}
+			//neighbours at the same height become one segment
+			for (size_t i{}; i + 1 < mSkyline.size();) {
+				if (mSkyline[i].y == mSkyline[i + 1].y) {
+					mSkyline[i].w += mSkyline[i + 1].w;
+					mSkyline.erase(mSkyline.begin() + i + 1);
+				}
+				else ++i;
+			}
+
+			mUsedWidth = std::max(mUsedWidth, right);
+			mUsedHeight = std::max(mUsedHeight, bestTop);
+			return true;
+		}
+
+		unsigned int GetUsedWidth() const { return mUsedWidth; }
+		unsigned int GetUsedHeight() const { return mUsedHeight; }
+
+	private:
+		struct Segment {
+			unsigned int x, y, w;
+		};
+
+		unsigned int mWidth, mHeight;
+		unsigned int mUsedWidth{}, mUsedHeight{};
+		std::vector<Segment> mSkyline;
+	};
+}
@@ -0,0 +1,116 @@
+#pragma once
+/******************************************************************************/
+/*!
+\par        Image Engine
+\file       TerrainGrid.hpp
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief		baked uniform grid of static level terrain
+
+			axis aligned static boxes are merged into as few solid rects as
+			possible so bodies sliding across a floor made of tiles do not
+			catch on the edges between them, then bucketed into a flat grid.
+			the grid is built once at level load and never updated.
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+			or disclosure of this file or its contents without the prior
+			written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+
+#include "Math/MathUtils.h"
+#include <Core/Types.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace Collision {
+	//one static box handed to the bake
+	struct TerrainTile {
+		Vec2 min{}, max{};
+		float friction{};
+		uint32_t category{};
+		uint32_t mask{};
+		Entity entity{};
+	};
+
+	//solid rect made of one or more tiles, entity is the tile that stands in
+	//for the whole rect in pairs and arbiters
+	struct TerrainRect {
+		Vec2 min{}, max{};
+		float friction{};
+		uint32_t category{};
+		uint32_t mask{};
+		Entity entity{};
+		uint32_t firstTile{};
+		uint32_t tileCount{};
+	};
+
+	class TerrainGrid {
+	public:
+		void Clear();
+		void Build(std::vector<TerrainTile> tiles, float cellSize);
+
+		/*  _________________________________________________________________________ */
+		/*! Query
+
+		@param min Minimum corner of the query region.
+		@param max Maximum corner of the query region.
+		@param fn Called with the index of every rect overlapping the region.
+
+		@return none.
+
+		Each rect is reported once even when it spans several cells. The
+		compares are strict like CheckAABBDiscrete.
+		*/
+		template <typename _fn>
+		void Query(Vec2 const& min, Vec2 const& max, _fn fn) {
+			if (mRects.empty()) return;
+			int x0{ CellX(min.x) }, x1{ CellX(max.x) }, y0{ CellY(min.y) }, y1{ CellY(max.y) };
+			if (x1 < 0 || y1 < 0 || x0 >= mCols || y0 >= mRows) return;
+			x0 = std::max(x0, 0); y0 = std::max(y0, 0);
+			x1 = std::min(x1, mCols - 1); y1 = std::min(y1, mRows - 1);
+
+			//stamp instead of a visited set, wraps after 4 billion queries
+			if (++mQueryId == 0) {
+				std::fill(mStamps.begin(), mStamps.end(), 0u);
+				mQueryId = 1;
+			}
+			for (int y{ y0 }; y <= y1; ++y) {
+				for (int x{ x0 }; x <= x1; ++x) {
+					size_t cell{ static_cast<size_t>(y) * mCols + x };
+					for (uint32_t i{ mCellStart[cell] }; i < mCellStart[cell + 1]; ++i) {
+						uint32_t r{ mCellRects[i] };
+						if (mStamps[r] == mQueryId) continue;
+						mStamps[r] = mQueryId;
+						TerrainRect const& rect{ mRects[r] };
+						if (min.x < rect.max.x && max.x > rect.min.x && min.y < rect.max.y && max.y > rect.min.y) fn(r);
+					}
+				}
+			}
+		}
+
+		TerrainRect const& GetRect(size_t i) const { return mRects[i]; }
+		size_t RectCount() const { return mRects.size(); }
+		//tiles of a rect are stored contiguously starting at firstTile
+		TerrainTile const& GetTile(size_t i) const { return mTiles[i]; }
+		size_t TileCount() const { return mTiles.size(); }
+	private:
+		int CellX(float x) const { return static_cast<int>(floorf((x - mOrigin.x) * mInvCellSize)); }
+		int CellY(float y) const { return static_cast<int>(floorf((y - mOrigin.y) * mInvCellSize)); }
+
+		std::vector<TerrainRect> mRects;
+		std::vector<TerrainTile> mTiles;
+		//cell c owns mCellRects[mCellStart[c], mCellStart[c + 1])
+		std::vector<uint32_t> mCellStart;
+		std::vector<uint32_t> mCellRects;
+		std::vector<uint32_t> mStamps;
+		uint32_t mQueryId{};
+		Vec2 mOrigin{};
+		float mInvCellSize{ 1.f };
+		int mCols{}, mRows{};
+	};
+}
@@ -8,7 +8,7 @@
 
 \brief      Header file for Mat4 math
 
-			This file contains the declaration for a Matrix 4 class.
+			This file contains the definition of a Matrix 4 class.
 			It provides various constructors, operators, and utility functions
 			for matrix operations such as addition, subtraction, multiplication,
 			transposition, and inversion.
@@ -21,7 +21,10 @@
 
 #pragma once
 #include <iostream>
+#include "MathUtils.h"
 #include <Math.h>
+#include <cstddef>
+#include "Vec2.h"
 #include "Vec4.h"
 
 namespace Image {
@@ -35,15 +38,15 @@ namespace Image {
 			Vec4 col1, col2,col3,col4;
 		};
 		Vec4 mMat[4];
-		Mat44();
-		Mat44(float const& val);
-		Mat44(Mat44 const& rhs);
-		Mat44(float _00, float _01, float _02, float _03,
+		constexpr Mat44();
+		constexpr Mat44(float const& val);
+		constexpr Mat44(Mat44 const& rhs) = default;
+		constexpr Mat44(float _00, float _01, float _02, float _03,
 			float _10, float _11, float _12, float _13,
 			float _20, float _21, float _22, float _23,
 			float _30, float _31, float _32, float _33);
-		Mat44(Vec4 col1, Vec4 col2, Vec4 col3, Vec4 col4);
-		Mat44 operator/=(float const& rhs);
+		constexpr Mat44(Vec4 col1, Vec4 col2, Vec4 col3, Vec4 col4);
+		constexpr Mat44 operator/=(float const& rhs);
 	}Mat44;
 	//	Vec4 operator[](int idx)const;
 	//	Vec4& operator[](int idx);
@@ -72,25 +75,621 @@ namespace Image {
 	//	Vec4 mMat[4];
 	//};
 	// Overloaded operators
-	bool operator==(Mat44 const& lhs, Mat44 const& rhs);
-	Mat44 operator+(Mat44 const& lhs, Mat44 const& rhs);
-	Mat44 operator-(Mat44 const& lhs, Mat44 const& rhs);
-	Mat44 operator*(Mat44 const& lhs, Mat44 const& rhs);
-	Mat44 operator+(Mat44 const& lhs, float const& val);
-	Mat44 operator-(Mat44 const& lhs, float const& val);
-	Mat44 operator*(Mat44 const& lhs, float const& val);
-	Mat44 operator/(Mat44 const& lhs, float const& val);
-	Mat44& operator+=(Mat44& lhs, Mat44 const& rhs);
-	Mat44& operator-=(Mat44& lhs, Mat44 const& rhs);
-
-
-	void Mat44Identity(Mat44& results);
-	void Mat44Translate(Mat44& results, float x, float y, float z);
-	void Mat44Scale(Mat44& results, float x, float y, float z);
-	void Mat44RotRad(Mat44& results, float angle);
-	void Mat44RotDeg(Mat44& results, float angle);
-	void Mat44Transpose(Mat44& results, Mat44 const& pMtx);
-	void Mat44Inverse(Mat44& results, Mat44 const& pMtx);
-	std::ostream& operator<<(std::ostream& os, Mat44& m);
-}
 
+	/*  _________________________________________________________________________ */
+	/*! Mat44
+
+	@param none.
+
+	@return none.
+
+	Default constructor. Set the values to 0
+	*/
+	inline constexpr Mat44::Mat44() :mMat{} {}
+
+	/*  _________________________________________________________________________ */
+	/*! Mat44
+
+	@param val
+	Value for the Matrix
+
+	@return none.
+
+	Constructor that sets both values to val
+	*/
+	inline constexpr Mat44::Mat44(float const& val) :mMat{ val,val,val,val } {}
+
+	/*  _________________________________________________________________________ */
+	/*! Mat44
+
+	@param  a00,  a01,  a02, a03, a10,  a11,  a12, a13, a20,  a21,  a22, a23,
+			a30, a31, a32, a33
+	Matrix Elements
+
+	@return none.
+
+	Constructor to initialize matrix with given values.
+	*/
+	inline constexpr Mat44::Mat44(float a00, float a01, float a02, float a03,
+		float a10, float a11, float a12, float a13,
+		float a20, float a21, float a22, float a23,
+		float a30, float a31, float a32, float a33) : mMat{ Vec4(a00,a01,a02,a03) ,
+															Vec4(a10,a11,a12,a13) ,
+															Vec4(a20,a21,a22,a23) ,
+															Vec4(a30,a31,a32,a33) } {}
+
+	/*  _________________________________________________________________________ */
+	/*! Mat44
+
+	@param col1
+	First column of the matrix
+
+	@param col2
+	Second column of the matrix
+
+	@param col3
+	Third column of the matrix
+
+	@param col4
+	Fourth column of the matrix
+
+	@return none.
+
+	Constructor to initialize matrix with 3 vectors.
+	*/
+	inline constexpr Mat44::Mat44(Vec4 col1, Vec4 col2, Vec4 col3, Vec4 col4) : mMat{ col1, col2, col3,col4 } {}
+
+	/*  _________________________________________________________________________ */
+	/*! operator/=
+
+	@param rhs
+	Scalar value to divide the matrix by.
+
+	@return Mat44
+	Modified matrix.
+
+	Divides each element of the matrix by the given scalar value.
+	*/
+	inline constexpr Mat44 Mat44::operator/=(float const& rhs){
+		mMat[0] /= rhs;
+		mMat[1] /= rhs;
+		mMat[2] /= rhs;
+		mMat[3] /= rhs;
+		return *this;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! Mat44Identity
+
+	@param results
+	Matrix to be set to identity.
+
+	@return none.
+
+	Sets the matrix to identity.
+	*/
+	inline constexpr void Mat44Identity(Mat44& results) {
+		results = { Vec4(1.f,0.f,0.f,0.f) ,
+					Vec4(0.f,1.f,0.f,0.f) ,
+					Vec4(0.f,0.f,1.f,0.f) ,
+					Vec4(0.f,0.f,0.f,1.f) };
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! Mat44Translate
+
+	@param results
+	Matrix to be set to identity.
+
+	@param x
+	Translate factor for the x-axis.
+
+	@param y
+	Translate factor for the y-axis.
+
+	@param z
+	Translate factor for the z-axis.
+
+	@return none.
+
+	Translate the matrix by its x and y.
+	*/
+	inline constexpr void Mat44Translate(Mat44& results, float x, float y, float z) {
+		results = { Vec4(1.f,0.f,0.f,x) ,
+					Vec4(0.f,1.f,0.f,y) ,
+					Vec4(0.f,0.f,1.f,z) ,
+					Vec4(0.f,0.f,0.f,1.f) };
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! Mat44Scale
+
+	@param results
+	Matrix to be scaled.
+
+	@param x
+	Scaling factor for the x-axis.
+
+	@param y
+	Scaling factor for the y-axis.
+
+	@param z
+	Translate factor for the z-axis.
+
+	@return none.
+
+	Scales the matrix by given factors.
+	*/
+	inline constexpr void Mat44Scale(Mat44& results, float x, float y, float z) {
+		results = { Vec4(x,0.f,0.f,0.f) ,
+					Vec4(0.f,y,0.f,0.f) ,
+					Vec4(0.f,0.f,z,0.f) ,
+					Vec4(0.f,0.f,0.f,1.f) };
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! Mat44RotRad
+
+	@param results
+	Matrix to be rotated.
+
+	@param angle
+	Rotation angle in radians.
+
+	@return none.
+
+	Rotates the matrix by a given angle in radians.
+	*/
+	inline void Mat44RotRad(Mat44& results, float angle) {
+		results = { Vec4(cosf(angle),-sinf(angle),0.f,0.f) , Vec4(sinf(angle),cosf(angle),0.f,0.f) , Vec4(0.f,0.f,1.f,0.f), Vec4(0.f,0.f,0.f,1.f) };
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! Mat44RotDeg
+
+	@param results
+	Matrix to be rotated.
+
+	@param angle
+	Rotation angle in degrees.
+
+	@return none.
+
+	Rotates the matrix by a given angle in degrees.
+	*/
+	inline void Mat44RotDeg(Mat44& results, float angle) {
+		//Find the anagle in rad
+		float rad = angle * static_cast<float>(gPI) / 180.f;
+		Mat44RotRad(results, rad);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! Mat44Transpose
+
+	@param results
+	Matrix to store the transposed result.
+
+	@param Mtx
+	Matrix to be transposed.
+
+	@return none.
+
+	Transposes the given matrix.
+	*/
+	inline constexpr void Mat44Transpose(Mat44& results, Mat44 const& pMtx) {
+		for (int i{}; i < 4; i++) {
+			for (int j{}; j < 4; j++) {
+				results.mMat[i][j] = pMtx.mMat[j][i];
+			}
+		}
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! Mat44Inverse
+
+	@param results
+	Matrix to store the inverted result.
+
+	@param Mtx
+	Matrix to be inverted.
+
+	@return none.
+
+	Inverts the given matrix.
+	*/
+	inline constexpr void Mat44Inverse(Mat44& results, Mat44 const& Mtx) {
+		Mat44 toTrans{};
+		Mat44Transpose(toTrans, Mtx);
+		float data00 = toTrans.mMat[2][2] * toTrans.mMat[3][3] - toTrans.mMat[3][2] * toTrans.mMat[2][3];
+		float data01 = toTrans.mMat[2][1] * toTrans.mMat[3][3] - toTrans.mMat[3][1] * toTrans.mMat[2][3];
+		float data02 = toTrans.mMat[2][1] * toTrans.mMat[3][2] - toTrans.mMat[3][1] * toTrans.mMat[2][2];
+		float data03 = toTrans.mMat[2][0] * toTrans.mMat[3][3] - toTrans.mMat[3][0] * toTrans.mMat[2][3];
+		float data04 = toTrans.mMat[2][0] * toTrans.mMat[3][2] - toTrans.mMat[3][0] * toTrans.mMat[2][2];
+		float data05 = toTrans.mMat[2][0] * toTrans.mMat[3][1] - toTrans.mMat[3][0] * toTrans.mMat[2][1];
+		float data06 = toTrans.mMat[1][2] * toTrans.mMat[3][3] - toTrans.mMat[3][2] * toTrans.mMat[1][3];
+		float data07 = toTrans.mMat[1][1] * toTrans.mMat[3][3] - toTrans.mMat[3][1] * toTrans.mMat[1][3];
+		float data08 = toTrans.mMat[1][1] * toTrans.mMat[3][2] - toTrans.mMat[3][1] * toTrans.mMat[1][2];
+		float data09 = toTrans.mMat[1][0] * toTrans.mMat[3][3] - toTrans.mMat[3][0] * toTrans.mMat[1][3];
+		float data10 = toTrans.mMat[1][0] * toTrans.mMat[3][2] - toTrans.mMat[3][0] * toTrans.mMat[1][2];
+		float data11 = toTrans.mMat[1][0] * toTrans.mMat[3][1] - toTrans.mMat[3][0] * toTrans.mMat[1][1];
+		float data12 = toTrans.mMat[1][2] * toTrans.mMat[2][3] - toTrans.mMat[2][2] * toTrans.mMat[1][3];
+		float data13 = toTrans.mMat[1][1] * toTrans.mMat[2][3] - toTrans.mMat[2][1] * toTrans.mMat[1][3];
+		float data14 = toTrans.mMat[1][1] * toTrans.mMat[2][2] - toTrans.mMat[2][1] * toTrans.mMat[1][2];
+		float data15 = toTrans.mMat[1][0] * toTrans.mMat[2][3] - toTrans.mMat[2][0] * toTrans.mMat[1][3];
+		float data16 = toTrans.mMat[1][0] * toTrans.mMat[2][2] - toTrans.mMat[2][0] * toTrans.mMat[1][2];
+		float data17 = toTrans.mMat[1][0] * toTrans.mMat[2][1] - toTrans.mMat[2][0] * toTrans.mMat[1][1];
+
+		Mat44 temp{};
+		temp.mMat[0][0] = +(toTrans.mMat[1][1] * data00 - toTrans.mMat[1][2] * data01 + toTrans.mMat[1][3] * data02);
+		temp.mMat[0][1] = -(toTrans.mMat[1][0] * data00 - toTrans.mMat[1][2] * data03 + toTrans.mMat[1][3] * data04);
+		temp.mMat[0][2] = +(toTrans.mMat[1][0] * data01 - toTrans.mMat[1][1] * data03 + toTrans.mMat[1][3] * data05);
+		temp.mMat[0][3] = -(toTrans.mMat[1][0] * data02 - toTrans.mMat[1][1] * data04 + toTrans.mMat[1][2] * data05);
+
+		temp.mMat[1][0] = -(toTrans.mMat[0][1] * data00 - toTrans.mMat[0][2] * data01 + toTrans.mMat[0][3] * data02);
+		temp.mMat[1][1] = +(toTrans.mMat[0][0] * data00 - toTrans.mMat[0][2] * data03 + toTrans.mMat[0][3] * data04);
+		temp.mMat[1][2] = -(toTrans.mMat[0][0] * data01 - toTrans.mMat[0][1] * data03 + toTrans.mMat[0][3] * data05);
+		temp.mMat[1][3] = +(toTrans.mMat[0][0] * data02 - toTrans.mMat[0][1] * data04 + toTrans.mMat[0][2] * data05);
+
+		temp.mMat[2][0] = +(toTrans.mMat[0][1] * data06 - toTrans.mMat[0][2] * data07 + toTrans.mMat[0][3] * data08);
+		temp.mMat[2][1] = -(toTrans.mMat[0][0] * data06 - toTrans.mMat[0][2] * data09 + toTrans.mMat[0][3] * data10);
+		temp.mMat[2][2] = +(toTrans.mMat[0][0] * data07 - toTrans.mMat[0][1] * data09 + toTrans.mMat[0][3] * data11);
+		temp.mMat[2][3] = -(toTrans.mMat[0][0] * data08 - toTrans.mMat[0][1] * data10 + toTrans.mMat[0][2] * data11);
+
+		temp.mMat[3][0] = -(toTrans.mMat[0][1] * data12 - toTrans.mMat[0][2] * data13 + toTrans.mMat[0][3] * data14);
+		temp.mMat[3][1] = +(toTrans.mMat[0][0] * data12 - toTrans.mMat[0][2] * data15 + toTrans.mMat[0][3] * data16);
+		temp.mMat[3][2] = -(toTrans.mMat[0][0] * data13 - toTrans.mMat[0][1] * data15 + toTrans.mMat[0][3] * data17);
+		temp.mMat[3][3] = +(toTrans.mMat[0][0] * data14 - toTrans.mMat[0][1] * data16 + toTrans.mMat[0][2] * data17);
+		float Determinant =
+			+toTrans.mMat[0][0] * temp.mMat[0][0]
+			+ toTrans.mMat[0][1] * temp.mMat[0][1]
+			+ toTrans.mMat[0][2] * temp.mMat[0][2]
+			+ toTrans.mMat[0][3] * temp.mMat[0][3];
+
+		temp /= Determinant;
+		results = temp;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator<<
+
+	@param os
+	Output stream.
+
+	@param m
+	Matrix to be printed.
+
+	@return std::ostream&.
+	Reference to the output stream.
+
+	Prints the matrix to the output stream.
+	*/
+	inline std::ostream& operator<<(std::ostream& os, Mat44& m) {
+		for (int i{}; i < 4; ++i) {
+			os << m.mMat[0][i] << '\t' << m.mMat[1][i] << '\t' << m.mMat[2][i] <<'\t' << m.mMat[3][i] << std::endl;
+		}
+		return os;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator==
+
+	@param lhs
+	Left-hand side matrix.
+
+	@param rhs
+	right-hand side matrix.
+
+	@return bool
+	True if matrices are equal, false otherwise.
+
+	Compares two matrices for equality.
+	*/
+	[[nodiscard]] inline constexpr bool operator==(Mat44 const& lhs, Mat44 const& rhs) {
+		return (lhs.mMat[0] == rhs.mMat[0] && lhs.mMat[1] == rhs.mMat[1] && lhs.mMat[2] == rhs.mMat[2] && lhs.mMat[3] == rhs.mMat[3]);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator+
+
+	@param lhs
+	Left-hand side matrix.
+
+	@param rhs
+	Right-hand side matrix.
+
+	@return Mat4
+	Resultant matrix after addition.
+
+	Adds two matrices.
+	*/
+	[[nodiscard]] inline constexpr Mat44 operator+(Mat44 const& lhs, Mat44 const& rhs) {
+		return Mat44(lhs.mMat[0] + rhs.mMat[0], lhs.mMat[1] + rhs.mMat[1], lhs.mMat[2] + rhs.mMat[2], lhs.mMat[3] + rhs.mMat[3]);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator-
+
+	@param lhs
+	Left-hand side matrix.
+
+	@param rhs
+	Right-hand side matrix.
+
+	@return Mat44
+	Resultant matrix after subtraction.
+
+	Subtracts one matrix from another.
+	*/
+	[[nodiscard]] inline constexpr Mat44 operator-(Mat44 const& lhs, Mat44 const& rhs) {
+		return Mat44(lhs.mMat[0] - rhs.mMat[0], lhs.mMat[1] - rhs.mMat[1], lhs.mMat[2] - rhs.mMat[2], lhs.mMat[3] - rhs.mMat[3]);
+
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator*
+
+	@param lhs
+	Left-hand side matrix.
+
+	@param rhs
+	Right-hand side matrix.
+
+	@return Mat44
+	Resultant matrix after multiplication.
+
+	Multiplies two matrices.
+	*/
+	[[nodiscard]] inline constexpr Mat44 operator*(Mat44 const& lhs, Mat44 const& rhs) {
+#ifdef IMAGE_MATH_SSE
+		if (!std::is_constant_evaluated()) {
+			//each result column is the lhs columns weighted by a rhs column, summed in the same order as below
+			__m128 c0{ LoadVec4(lhs.mMat[0]) }, c1{ LoadVec4(lhs.mMat[1]) }, c2{ LoadVec4(lhs.mMat[2]) }, c3{ LoadVec4(lhs.mMat[3]) };
+			Mat44 product;
+			for (int i{}; i < 4; ++i) {
+				Vec4 const& col{ rhs.mMat[i] };
+				__m128 sum{ _mm_mul_ps(c0, _mm_set1_ps(col.mData[0])) };
+				sum = _mm_add_ps(sum, _mm_mul_ps(c1, _mm_set1_ps(col.mData[1])));
+				sum = _mm_add_ps(sum, _mm_mul_ps(c2, _mm_set1_ps(col.mData[2])));
+				sum = _mm_add_ps(sum, _mm_mul_ps(c3, _mm_set1_ps(col.mData[3])));
+				_mm_storeu_ps(product.mMat[i].mData, sum);
+			}
+			return product;
+		}
+#endif
+		Mat44 result;
+
+		result.mMat[0][0] = lhs.mMat[0][0] * rhs.mMat[0][0] + lhs.mMat[1][0] * rhs.mMat[0][1] + lhs.mMat[2][0] * rhs.mMat[0][2] + lhs.mMat[3][0] * rhs.mMat[0][3];
+		result.mMat[0][1] = lhs.mMat[0][1] * rhs.mMat[0][0] + lhs.mMat[1][1] * rhs.mMat[0][1] + lhs.mMat[2][1] * rhs.mMat[0][2] + lhs.mMat[3][1] * rhs.mMat[0][3];
+		result.mMat[0][2] = lhs.mMat[0][2] * rhs.mMat[0][0] + lhs.mMat[1][2] * rhs.mMat[0][1] + lhs.mMat[2][2] * rhs.mMat[0][2] + lhs.mMat[3][2] * rhs.mMat[0][3];
+		result.mMat[0][3] = lhs.mMat[0][3] * rhs.mMat[0][0] + lhs.mMat[1][3] * rhs.mMat[0][1] + lhs.mMat[2][3] * rhs.mMat[0][2] + lhs.mMat[3][3] * rhs.mMat[0][3];
+
+		result.mMat[1][0] = lhs.mMat[0][0] * rhs.mMat[1][0] + lhs.mMat[1][0] * rhs.mMat[1][1] + lhs.mMat[2][0] * rhs.mMat[1][2] + lhs.mMat[3][0] * rhs.mMat[1][3];
+		result.mMat[1][1] = lhs.mMat[0][1] * rhs.mMat[1][0] + lhs.mMat[1][1] * rhs.mMat[1][1] + lhs.mMat[2][1] * rhs.mMat[1][2] + lhs.mMat[3][1] * rhs.mMat[1][3];
+		result.mMat[1][2] = lhs.mMat[0][2] * rhs.mMat[1][0] + lhs.mMat[1][2] * rhs.mMat[1][1] + lhs.mMat[2][2] * rhs.mMat[1][2] + lhs.mMat[3][2] * rhs.mMat[1][3];
+		result.mMat[1][3] = lhs.mMat[0][3] * rhs.mMat[1][0] + lhs.mMat[1][3] * rhs.mMat[1][1] + lhs.mMat[2][3] * rhs.mMat[1][2] + lhs.mMat[3][3] * rhs.mMat[1][3];
+
+		result.mMat[2][0] = lhs.mMat[0][0] * rhs.mMat[2][0] + lhs.mMat[1][0] * rhs.mMat[2][1] + lhs.mMat[2][0] * rhs.mMat[2][2] + lhs.mMat[3][0] * rhs.mMat[2][3];
+		result.mMat[2][1] = lhs.mMat[0][1] * rhs.mMat[2][0] + lhs.mMat[1][1] * rhs.mMat[2][1] + lhs.mMat[2][1] * rhs.mMat[2][2] + lhs.mMat[3][1] * rhs.mMat[2][3];
+		result.mMat[2][2] = lhs.mMat[0][2] * rhs.mMat[2][0] + lhs.mMat[1][2] * rhs.mMat[2][1] + lhs.mMat[2][2] * rhs.mMat[2][2] + lhs.mMat[3][2] * rhs.mMat[2][3];
+		result.mMat[2][3] = lhs.mMat[0][3] * rhs.mMat[2][0] + lhs.mMat[1][3] * rhs.mMat[2][1] + lhs.mMat[2][3] * rhs.mMat[2][2] + lhs.mMat[3][3] * rhs.mMat[2][3];
+
+		result.mMat[3][0] = lhs.mMat[0][0] * rhs.mMat[3][0] + lhs.mMat[1][0] * rhs.mMat[3][1] + lhs.mMat[2][0] * rhs.mMat[3][2] + lhs.mMat[3][0] * rhs.mMat[3][3];
+		result.mMat[3][1] = lhs.mMat[0][1] * rhs.mMat[3][0] + lhs.mMat[1][1] * rhs.mMat[3][1] + lhs.mMat[2][1] * rhs.mMat[3][2] + lhs.mMat[3][1] * rhs.mMat[3][3];
+		result.mMat[3][2] = lhs.mMat[0][2] * rhs.mMat[3][0] + lhs.mMat[1][2] * rhs.mMat[3][1] + lhs.mMat[2][2] * rhs.mMat[3][2] + lhs.mMat[3][2] * rhs.mMat[3][3];
+		result.mMat[3][3] = lhs.mMat[0][3] * rhs.mMat[3][0] + lhs.mMat[1][3] * rhs.mMat[3][1] + lhs.mMat[2][3] * rhs.mMat[3][2] + lhs.mMat[3][3] * rhs.mMat[3][3];
+
+		return result;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator+
+
+	@param lhs
+	Left-hand side matrix.
+
+	@param val
+	Scalar value to be added to each element of the matrix.
+
+	@return Mat44
+	Resultant matrix after addition.
+
+	Adds a scalar value to each element of the matrix.
+	*/
+	[[nodiscard]] inline constexpr Mat44 operator+(Mat44 const& lhs, float const& val) {
+		return Mat44(lhs.mMat[0] + val, lhs.mMat[1] + val, lhs.mMat[2] + val, lhs.mMat[3] + val);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator-
+
+	@param lhs
+	Left-hand side matrix.
+
+	@param val
+	Scalar value to be subtracted from each element of the matrix.
+
+	@return Mat44
+	Resultant matrix after subtraction.
+
+	Subtracts a scalar value from each element of the matrix.
+	*/
+	[[nodiscard]] inline constexpr Mat44 operator-(Mat44 const& lhs, float const& val) {
+		return Mat44(lhs.mMat[0] - val, lhs.mMat[1] - val, lhs.mMat[2] - val,lhs.mMat[3] - val);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator*
+
+	@param lhs
+	Left-hand side matrix.
+
+	@param val
+	Scalar value to multiply each element of the matrix.
+
+	@return Mat44
+	Resultant matrix after multiplication.
+
+	Multiplies each element of the matrix by a scalar value.
+	*/
+	[[nodiscard]] inline constexpr Mat44 operator*(Mat44 const& lhs, float const& val) {
+		return Mat44(lhs.mMat[0] * val, lhs.mMat[1] * val, lhs.mMat[2] * val, lhs.mMat[3] * val);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator/
+
+	@param lhs
+	Left-hand side matrix.
+
+	@param val
+	Scalar value to divide each element of the matrix.
+
+	@return Mat44
+	Resultant matrix after division.
+
+	Divides each element of the matrix by a scalar value.
+	*/
+	[[nodiscard]] inline constexpr Mat44 operator/(Mat44 const& lhs, float const& val) {
+		return Mat44(lhs.mMat[0] / val, lhs.mMat[1] / val, lhs.mMat[2] / val, lhs.mMat[3] / val);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator+=
+
+	@param lhs
+	Left-hand side matrix.
+
+	@param rhs
+	Right-hand side matrix.
+
+	@return Mat44&
+	Reference to the left-hand side matrix after addition.
+
+	Adds the right-hand side matrix to the left-hand side matrix.
+	*/
+	inline constexpr Mat44& operator+=(Mat44& lhs, Mat44 const& rhs) {
+		lhs.mMat[0] += rhs.mMat[0];
+		lhs.mMat[1] += rhs.mMat[1];
+		lhs.mMat[2] += rhs.mMat[2];
+		lhs.mMat[3] += rhs.mMat[3];
+		return lhs;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator-=
+
+	@param lhs
+	Left-hand side matrix.
+
+	@param rhs
+	Right-hand side matrix.
+
+	@return Mat4&
+	Reference to the left-hand side matrix after subtraction.
+
+	Subtracts the right-hand side matrix from the left-hand side matrix.
+	*/
+	inline constexpr Mat44& operator-=(Mat44& lhs, Mat44 const& rhs) {
+		lhs.mMat[0] -= rhs.mMat[0];
+		lhs.mMat[1] -= rhs.mMat[1];
+		lhs.mMat[2] -= rhs.mMat[2];
+		lhs.mMat[3] -= rhs.mMat[3];
+		return lhs;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator*
+
+	@param lhs
+	Left-hand side matrix.
+
+	@param rhs
+	Right-hand side vector.
+
+	@return Vec4
+	Resultant vector after multiplication.
+
+	Multiplies the matrix by a vector, same convention as Mat22 and Mat33.
+	*/
+	[[nodiscard]] inline constexpr Vec4 operator*(Mat44 const& lhs, Vec4 const& rhs) {
+#ifdef IMAGE_MATH_SSE
+		if (!std::is_constant_evaluated()) {
+			__m128 sum{ _mm_mul_ps(LoadVec4(lhs.mMat[0]), _mm_set1_ps(rhs.mData[0])) };
+			sum = _mm_add_ps(sum, _mm_mul_ps(LoadVec4(lhs.mMat[1]), _mm_set1_ps(rhs.mData[1])));
+			sum = _mm_add_ps(sum, _mm_mul_ps(LoadVec4(lhs.mMat[2]), _mm_set1_ps(rhs.mData[2])));
+			sum = _mm_add_ps(sum, _mm_mul_ps(LoadVec4(lhs.mMat[3]), _mm_set1_ps(rhs.mData[3])));
+			return StoreVec4(sum);
+		}
+#endif
+		Vec4 result;
+		for (int i{}; i < 4; ++i) {
+			result.mData[i] = lhs.mMat[0].mData[i] * rhs.mData[0] + lhs.mMat[1].mData[i] * rhs.mData[1]
+				+ lhs.mMat[2].mData[i] * rhs.mData[2] + lhs.mMat[3].mData[i] * rhs.mData[3];
+		}
+		return result;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! Mat44TransformPoints
+
+	@param mtx
+	Matrix to transform by.
+
+	@param in
+	Points to transform.
+
+	@param out
+	Transformed points, may be the same array as in.
+
+	@param count
+	Number of points.
+
+	@return none.
+
+	Transforms count points by one matrix. The columns are loaded once for
+	the whole batch instead of once per point.
+	*/
+	inline void Mat44TransformPoints(Mat44 const& mtx, Vec4 const* in, Vec4* out, size_t count) {
+#ifdef IMAGE_MATH_SSE
+		__m128 c0{ LoadVec4(mtx.mMat[0]) }, c1{ LoadVec4(mtx.mMat[1]) }, c2{ LoadVec4(mtx.mMat[2]) }, c3{ LoadVec4(mtx.mMat[3]) };
+		for (size_t i{}; i < count; ++i) {
+			__m128 sum{ _mm_mul_ps(c0, _mm_set1_ps(in[i].mData[0])) };
+			sum = _mm_add_ps(sum, _mm_mul_ps(c1, _mm_set1_ps(in[i].mData[1])));
+			sum = _mm_add_ps(sum, _mm_mul_ps(c2, _mm_set1_ps(in[i].mData[2])));
+			sum = _mm_add_ps(sum, _mm_mul_ps(c3, _mm_set1_ps(in[i].mData[3])));
+			_mm_storeu_ps(out[i].mData, sum);
+		}
+#else
+		for (size_t i{}; i < count; ++i) out[i] = mtx * in[i];
+#endif
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! Mat44TransformPoints
+
+	@param mtx
+	Matrix to transform by.
+
+	@param in
+	2d points, taken as (x, y, 0, 1).
+
+	@param out
+	x and y of the transformed points, may be the same array as in.
+
+	@param count
+	Number of points.
+
+	@return none.
+
+	Transforms count 2d points by one matrix, for quad corners and the like.
+	*/
+	inline void Mat44TransformPoints(Mat44 const& mtx, Vec2 const* in, Vec2* out, size_t count) {
+		Vec4 const& c0{ mtx.mMat[0] };
+		Vec4 const& c1{ mtx.mMat[1] };
+		Vec4 const& c3{ mtx.mMat[3] };
+		for (size_t i{}; i < count; ++i) {
+			float x{ in[i].mData[0] }, y{ in[i].mData[1] };
+			out[i] = Vec2{ c0.mData[0] * x + c1.mData[0] * y + c3.mData[0], c0.mData[1] * x + c1.mData[1] * y + c3.mData[1] };
+		}
+	}
+}
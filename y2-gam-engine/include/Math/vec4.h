@@ -8,7 +8,7 @@
 
 \brief      Header file for Vec4 math
 
-            This file contains the declaration for a vector 4 class.
+            This file contains the definition of a vector 4 class.
             It provides various constructors, operators, and utility functions
             for vector operations such as dot product, cross product,
             and normalization.
@@ -24,8 +24,14 @@
 #include <math.h>
 #include <stdexcept>
 #include <cassert>
-#include "Vec3.h"
-#include "Vec2.h"
+#include <type_traits>
+
+//sse2 is always there on x86/x64, IMAGE_MATH_NO_SSE forces the scalar code
+#if !defined(IMAGE_MATH_NO_SSE) && (defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__))
+#define IMAGE_MATH_SSE 1
+#include <xmmintrin.h>
+#endif
+
 namespace Image {
     union Vec3;
     union Vec2;
@@ -42,42 +48,469 @@ namespace Image {
 
         float mData[4];
         //Constructors
-        Vec4();
-        Vec4(float val);
-        Vec4(float x, float y, float z, float w);
-        Vec4(Vec2 const& rhs);
-        Vec4(Vec3 const& rhs);
-        Vec4(Vec4 const& rhs);
+        constexpr Vec4();
+        constexpr Vec4(float val);
+        constexpr Vec4(float x, float y, float z, float w);
+        constexpr Vec4(Vec2 const& rhs);
+        constexpr Vec4(Vec3 const& rhs);
+        constexpr Vec4(Vec4 const& rhs) = default;
         
         // Assignment operators
-        Vec4& operator += (Vec4 const& rhs);
-        Vec4& operator -= (Vec4 const& rhs);
-        Vec4& operator *= (float rhs);
-        Vec4& operator /= (float rhs);
+        constexpr Vec4& operator += (Vec4 const& rhs);
+        constexpr Vec4& operator -= (Vec4 const& rhs);
+        constexpr Vec4& operator *= (float rhs);
+        constexpr Vec4& operator /= (float rhs);
 
         // Unary operators
-        Vec4 operator -() const;
-        float operator[](int idx)const;
-        float& operator[](int idx);
+        [[nodiscard]] constexpr Vec4 operator -() const;
+        [[nodiscard]] constexpr float operator[](int idx)const;
+        constexpr float& operator[](int idx);
 
     }Vec4;
 
 #ifdef _MSC_VER
 // Supress warning: nonstandard extension used : nameless struct/union
 #pragma warning( default : 4201 )
+#endif
+
+#ifdef IMAGE_MATH_SSE
+	//unaligned, Vec4 keeps its 4 byte alignment so existing structs do not change layout
+	inline __m128 LoadVec4(Vec4 const& v) { return _mm_loadu_ps(v.mData); }
+	inline Vec4 StoreVec4(__m128 v) {
+		Vec4 result;
+		_mm_storeu_ps(result.mData, v);
+		return result;
+	}
 #endif
     // Overloads
-    float length(Vec4 const& rhs);
-    Vec4 normalized(Vec4 const& rhs);
-    float dot(Vec4 const& lhs, Vec4 const& rhs);
-    Vec4 operator+(Vec4 const& lhs, Vec4 const& rhs);
-    Vec4 operator-(Vec4 const& lhs, Vec4 const& rhs);
-    Vec4 operator*(Vec4 const& lhs, Vec4 const& rhs);
-    Vec4 operator+(Vec4 const& lhs, float val);
-    Vec4 operator-(Vec4 const& lhs, float val);
-    Vec4 operator*(Vec4 const& lhs, float val);
-    Vec4 operator/(Vec4 const& lhs, float val);
-    bool operator==(Vec4 const& lhs, Vec4 const& rhs);
-
-    std::ostream& operator<<(std::ostream& os, Vec4 const& v);
+
+	/*  _________________________________________________________________________ */
+	/*! Vec4
+
+	@param none.
+
+	@return none.
+
+	Default constructor. Set the values to 0
+	*/
+	inline constexpr Vec4::Vec4() :mData{ 0,0,0,0 } {}
+
+	/*  _________________________________________________________________________ */
+	/*! Vec4
+
+	@param val
+	Value for the vector
+
+	@return none.
+
+	Constructor that sets both values to val
+	*/
+	inline constexpr Vec4::Vec4(float val) :mData{ val,val,val,val } {}
+
+	/*  _________________________________________________________________________ */
+	/*! Vec4
+
+	@param x
+	X component of the vector
+
+	@param y
+	Y component of the vector
+
+	@param z
+	Z component of the vector
+
+	@param w
+	W component of the vector
+
+	@return none.
+
+	Constructor that sets the x, y, z and w
+	*/
+	inline constexpr Vec4::Vec4(float x, float y, float z, float w) : mData{ x,y,z,w } {}
+
+
+	/*  _________________________________________________________________________ */
+	/*! operator +=
+
+	@param rhs
+	Vector to add from.
+
+	@return Vec4&
+	Reference to the modified vector.
+
+	Adds the rhs vector to its current vector.
+	*/
+	inline constexpr Vec4& Vec4::operator+=(Vec4 const& rhs) {
+		mData[0] += rhs.mData[0];
+		mData[1] += rhs.mData[1];
+		mData[2] += rhs.mData[2];
+		mData[3] += rhs.mData[3];
+		return *this;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator-=
+
+	@param rhs
+	Vector to subtract from.
+
+	@return Vec4&
+	Reference to the modified vector.
+
+	Subtracts the rhs vector from its current vector.
+	*/
+	inline constexpr Vec4& Vec4::operator-=(Vec4 const& rhs) {
+		mData[0] -= rhs.mData[0];
+		mData[1] -= rhs.mData[1];
+		mData[2] -= rhs.mData[2];
+		mData[3] -= rhs.mData[3];
+		return *this;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator*=
+
+	@param rhs
+	Scalar value to multiply with.
+
+	@return Vec4&
+	Reference to the modified vector.
+
+	Multiplies the vector by a scalar value.
+	*/
+	inline constexpr Vec4& Vec4::operator*=(float rhs) {
+		mData[0] *= rhs;
+		mData[1] *= rhs;
+		mData[2] *= rhs;
+		mData[3] *= rhs;
+		return *this;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator/=
+
+	@param rhs
+	Scalar value to divide by.
+
+	@return Vec4&
+	Reference to the modified vector.
+
+	Divides the vector by a scalar value.
+	*/
+	inline constexpr Vec4& Vec4::operator/=(float rhs) {
+		mData[0] /= rhs;
+		mData[1] /= rhs;
+		mData[2] /= rhs;
+		mData[2] /= rhs;
+		return *this;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator-
+
+	@param none.
+
+	@return Vec4
+	A new vector with negated components.
+
+	Negates the vector components.
+	*/
+	inline constexpr Vec4 Vec4::operator-() const {
+		Vec4 temp{ *this };
+		temp.mData[0] = -mData[0];
+		temp.mData[1] = -mData[1];
+		temp.mData[2] = -mData[2];
+		temp.mData[3] = -mData[3];
+		return temp;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator[]
+
+	@param idx
+	Index of the component to access.
+
+	@return float
+	The value of the component at the given index.
+
+	Accesses the vector component at the specified index.
+	*/
+	inline constexpr float Vec4::operator[](int idx) const {
+		assert((idx >= 0 && idx < 4) && "Ensure index is within bounds");
+		return mData[idx];
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator[]
+
+	@param idx
+	Index of the component to access.
+
+	@return float&
+	Reference to the component at the given index.
+
+	Accesses the vector component at the specified index.
+	*/
+	inline constexpr float& Vec4::operator[](int idx) {
+		assert((idx >= 0 && idx < 4) && "Ensure index is within bounds");
+		return mData[idx];
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! length
+
+	@param rhs
+	Vector whose length is to be calculated.
+
+	@return float
+	Length of the vector.
+
+	Computes the length of the given vector.
+	*/
+	[[nodiscard]] inline float length(Vec4 const& rhs) {
+		return std::sqrt(rhs.mData[0] * rhs.mData[0] + rhs.mData[1] * rhs.mData[1] + rhs.mData[2] * rhs.mData[2]+ rhs.mData[3]* rhs.mData[3]);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! normalized
+
+	@param rhs
+	Right-hand side vector.
+
+	@return Vec4
+	Normalized vector
+
+	Computes the normalized of the vector.
+	*/
+	[[nodiscard]] inline Vec4 normalized(Vec4 const& rhs) {
+		float len = length(rhs);
+		assert((len != 0) && "Divide by 0");
+		return { rhs.mData[0] / len, rhs.mData[1] / len,rhs.mData[2] / len ,rhs.mData[3]/len};
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! dot
+
+	@param lhs
+	Left-hand side vector.
+
+	@param rhs
+	Right-hand side vector.
+
+	@return float
+	Dot product of the two vectors.
+
+	Computes the dot product of two vectors.
+	*/
+	[[nodiscard]] inline constexpr float dot(Vec4 const& lhs, Vec4 const& rhs) {
+		return lhs.mData[0] * rhs.mData[0] + lhs.mData[1] * rhs.mData[1] + lhs.mData[2] * rhs.mData[2] + lhs.mData[3] * rhs.mData[3];
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator+
+
+	@param lhs
+	Left-hand side vector.
+
+	@param rhs
+	Right-hand side vector.
+
+	@return Vec4
+	Addition of the two vectors.
+
+	Computes the addition of two vectors.
+	*/
+	[[nodiscard]] inline constexpr Vec4 operator+(Vec4 const& lhs, Vec4 const& rhs) {
+#ifdef IMAGE_MATH_SSE
+		if (!std::is_constant_evaluated()) return StoreVec4(_mm_add_ps(LoadVec4(lhs), LoadVec4(rhs)));
+#endif
+		return Vec4(lhs.mData[0] + rhs.mData[0], lhs.mData[1] + rhs.mData[1], lhs.mData[2] + rhs.mData[2],lhs.mData[3]+rhs.mData[3]);
+	}
+
+
+	/*  _________________________________________________________________________ */
+	/*! operator-
+
+	@param lhs
+	Left-hand side vector.
+
+	@param rhs
+	Right-hand side vector.
+
+	@return Vec4
+	Subtraction of the two vectors.
+
+	Computes the Subtraction of two vectors.
+	*/
+	[[nodiscard]] inline constexpr Vec4 operator-(Vec4 const& lhs, Vec4 const& rhs) {
+#ifdef IMAGE_MATH_SSE
+		if (!std::is_constant_evaluated()) return StoreVec4(_mm_sub_ps(LoadVec4(lhs), LoadVec4(rhs)));
+#endif
+		return Vec4(lhs.mData[0] - rhs.mData[0], lhs.mData[1] - rhs.mData[1], lhs.mData[2] - rhs.mData[2], lhs.mData[3] - rhs.mData[3]);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator*
+
+	@param lhs
+	Left-hand side vector.
+
+	@param rhs
+	Right-hand side vector.
+
+	@return Vec4
+	Product of the two vectors.
+
+	Computes the product of two vectors.
+	*/
+	[[nodiscard]] inline constexpr Vec4 operator*(Vec4 const& lhs, Vec4 const& rhs) {
+#ifdef IMAGE_MATH_SSE
+		if (!std::is_constant_evaluated()) return StoreVec4(_mm_mul_ps(LoadVec4(lhs), LoadVec4(rhs)));
+#endif
+		return Vec4(lhs.mData[0] * rhs.mData[0], lhs.mData[1] * rhs.mData[1], lhs.mData[2] * rhs.mData[2], lhs.mData[3] * rhs.mData[3]);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator+
+
+	@param lhs
+	Left-hand side vector.
+
+	@param rhs
+	Right-hand side float.
+
+	@return Vec4
+	Addition between vector and a float
+
+	Computes the addition of a vector and a float
+	*/
+	[[nodiscard]] inline constexpr Vec4 operator+(Vec4 const& lhs, float val) {
+		return Vec4(lhs.mData[0] + val, lhs.mData[1] + val, lhs.mData[2] + val,lhs.mData[3]+val);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator-
+
+	@param lhs
+	Left-hand side vector.
+
+	@param rhs
+	Right-hand side float.
+
+	@return Vec4
+	Subtraction between vector and a float
+
+	Computes the Subtraction of a vector and a float
+	*/
+	[[nodiscard]] inline constexpr Vec4 operator-(Vec4 const& lhs, float val) {
+		return Vec4(lhs.mData[0] - val, lhs.mData[1] - val, lhs.mData[2] - val, lhs.mData[3] - val);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator*
+
+	@param lhs
+	Left-hand side vector.
+
+	@param rhs
+	Right-hand side float.
+
+	@return Vec4
+	Product between vector and a float
+
+	Computes the Product of a vector and a float
+	*/
+	[[nodiscard]] inline constexpr Vec4 operator*(Vec4 const& lhs, float val) {
+#ifdef IMAGE_MATH_SSE
+		if (!std::is_constant_evaluated()) return StoreVec4(_mm_mul_ps(LoadVec4(lhs), _mm_set1_ps(val)));
+#endif
+		return Vec4(lhs.mData[0] * val, lhs.mData[1] * val, lhs.mData[2] * val, lhs.mData[3] * val);
+	}
+
+
+	/*  _________________________________________________________________________ */
+	/*! operator/
+
+	@param lhs
+	Left-hand side vector.
+
+	@param rhs
+	Right-hand side float.
+
+	@return Vec4
+	Division between vector and a float
+
+	Computes the Division of a vector and a float
+	*/
+	[[nodiscard]] inline constexpr Vec4 operator/(Vec4 const& lhs, float val) {
+		return Vec4(lhs.mData[0] / val, lhs.mData[1] / val, lhs.mData[2] / val, lhs.mData[3] / val);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator==
+
+	@param lhs
+	Left-hand side vector.
+
+	@param rhs
+	Right-hand side vector.
+
+	@return bool
+	True if the vectors as the same else false
+
+	Checks if the vector are similar
+	*/
+	[[nodiscard]] inline constexpr bool operator==(Vec4 const& lhs, Vec4 const& rhs) {
+		return (lhs.mData[0] == rhs.mData[0] && lhs.mData[1] == rhs.mData[1] && lhs.mData[2] == rhs.mData[2] && lhs.mData[3]==rhs.mData[3]);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! operator<<
+
+	@param os
+	Output stream.
+
+	@param rhs
+	Vector to be printed.
+
+	@return std::ostream&
+	Reference to the output stream.
+
+	Outputs the vector to the given stream.
+	*/
+	inline std::ostream& operator<<(std::ostream& os, Vec4 const& rhs) {
+		os << rhs.mData[0] << ", " << rhs.mData[1] << ", " << rhs.mData[2] << ", " << rhs.mData[3];
+		return os;
+	}
+}
+
+#include "Vec2.h"
+#include "Vec3.h"
+namespace Image {
+	/*  _________________________________________________________________________ */
+	/*! Vec4
+
+	@param rhs
+	Vector to copy from
+
+	@return none.
+
+	Copy constructor that only takes the first 2 value of the vec2 and last 2 value
+	as 0
+	*/
+	inline constexpr Vec4::Vec4(Vec2 const& rhs) : mData{ rhs.mData[0],rhs.mData[1],0.f,0.f } {}
+
+
+	/*  _________________________________________________________________________ */
+	/*! Vec4
+
+	@param rhs
+	Vector to copy from.
+
+	@return none.
+
+	Copy constructor that only takes the first 3 value of the vec3 and last value
+	as 0.
+	*/
+	inline constexpr Vec4::Vec4(Vec3 const& rhs) : mData{ rhs.mData[0],rhs.mData[1],rhs.mData[2],0.f } {}
 }
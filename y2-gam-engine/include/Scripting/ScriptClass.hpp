@@ -25,6 +25,7 @@ namespace Image {
 
     MonoObject* Instantiate() const;
     MonoMethod* GetMethod(std::string const& name, int numParameters);
+    MonoMethod* FindMethod(std::string const& name, int numParameters) const;
     MonoObject* CallMethod(MonoObject* instance, MonoMethod* method, void** params = nullptr);
 
     std::string GetNamespace() const { return mClassNamespace; }
@@ -28,12 +28,24 @@ namespace Image {
 
     void CallOnCreate();
     void CallOnUpdate(float dt);
+    void CallOnContactBegin(Entity other);
+    void CallOnContactEnd(Entity other);
+    void CallOnTriggerBegin(Entity other);
+    void CallOnTriggerEnd(Entity other);
+
+  private:
+    void CallOptional(MonoMethod* method, Entity other);
 
   private:
     MonoObject* mInstance{ nullptr };
     MonoMethod* mConstructor{ nullptr };
     MonoMethod* mOnCreateMethod{ nullptr };
     MonoMethod* mOnUpdateMethod{ nullptr };
+    // Optional, nullptr when the script does not define them
+    MonoMethod* mOnContactBeginMethod{ nullptr };
+    MonoMethod* mOnContactEndMethod{ nullptr };
+    MonoMethod* mOnTriggerBeginMethod{ nullptr };
+    MonoMethod* mOnTriggerEndMethod{ nullptr };
     ScriptClass mScriptClass{};
   };
 }
\ No newline at end of file
@@ -34,6 +34,7 @@ namespace Image {
     static void PopulateEntityClassesFromAssembly(MonoAssembly* assembly);
     static void OnCreateEntity(Entity const& entity);
     static void OnUpdateEntity(Entity const& entity, float dt);
+    static void OnContactEvent(Event& event);
 
     static bool EntityClassExists(std::string const& className);
 
@@ -34,8 +34,5 @@ public:
 
 private:
 	//TODO REMOVE ------------TEMP------------------
-	std::shared_ptr<Texture> mIdle;
-	std::shared_ptr<Texture> mRun;
-	std::shared_ptr<Texture> mAttack;
 	std::vector<std::shared_ptr<SubTexture>> mSpriteList;
 };
@@ -21,14 +21,68 @@
 #include "DataMgmt/QuadTree/Quadtree.hpp"
 #include "Core/Physics.hpp"
 #include <Components/BoxCollider.hpp>
+#include "Math/AABBBatch.hpp"
+#include "Math/Narrowphase.hpp"
+#include "Math/TerrainGrid.hpp"
 
 namespace Collision {
 	using namespace Physics;
-    int ClipSegmentToLine(ClipVertex vOut[2], ClipVertex vIn[2], const Vec2& normal, float offset,
-        float clipEdge);
     void ComputeIncidentEdge(ClipVertex c[2], const Vec2& h, const Vec2& pos, const Mat22& rot,
         const Vec2& normal);
-	uint32_t Collide(Physics::Contact* contacts, RigidBody& b1, RigidBody& b2);
+	uint32_t Collide(Physics::Contact* contacts, RigidBody const& b1, RigidBody const& b2);
+	uint32_t CollideOBB(Physics::Contact* contacts, Vec2 const& pos1, Vec2 const& h1, Mat22 const& rot1,
+		Vec2 const& pos2, Vec2 const& h2, Mat22 const& rot2);
+	uint32_t CollideShapes(Physics::Contact* contacts, RigidBody const& b1, BoxCollider const& c1,
+		RigidBody const& b2, BoxCollider const& c2);
+	std::pair<Vec2, Vec2> GetAABBBody(RigidBody const& rb, ColliderShape shape);
+
+	//result of a raycast, fraction is along the segment from origin (0) to end (1)
+	struct RaycastHit {
+		Entity entity{};
+		Vec2 point{};
+		Vec2 normal{};
+		float fraction{};
+	};
+
+	//per collider data for the broadphase pair filter
+	struct ColliderFilter {
+		uint32_t category{};
+		uint32_t mask{};
+		bool isStatic{};
+		bool isTrigger{};
+	};
+	bool ShouldCollide(ColliderFilter const& a, ColliderFilter const& b);
+	bool Overlap(RigidBody const& b1, RigidBody const& b2);
+	bool Overlap(RigidBody const& b1, BoxCollider const& c1, RigidBody const& b2, BoxCollider const& c2);
+
+	//per body data the narrowphase reads instead of the components
+	struct NarrowBody {
+		Vec2 position{};
+		Vec2 halfExtents{};
+		Mat22 rotation{};
+		float friction{};
+		ColliderShape shape{};
+		//rotation in radians the matrix was built from
+		float angle{};
+	};
+
+	//a touching pair, key is the lower entity id in the high 32 bits
+	struct ContactPair {
+		uint64_t key{};
+		bool isTrigger{};
+		bool operator<(ContactPair const& rhs) const { return key < rhs.key; }
+		bool operator==(ContactPair const& rhs) const { return key == rhs.key; }
+	};
+
+	//time spent in the last Update
+	struct CollisionProfile {
+		int64_t broadphaseNs{};
+		int64_t narrowphaseNs{};
+	};
+
+	constexpr uint32_t NO_TERRAIN_RECT{ 0xFFFFFFFFu };
+	//cell edge of the terrain grid in world units
+	constexpr float TERRAIN_CELL_SIZE{ 16.f };
 
 	class CollisionSystem : public System
 	{
@@ -38,8 +92,64 @@ namespace Collision {
 		void Update(float dt);
 
 		void Debug();
+
+		//bakes the static terrain, call after a level is loaded or its terrain changed
+		void BakeTerrain();
+
+		void QueryAABB(Vec2 const& min, Vec2 const& max, std::vector<Entity>& out);
+		void QueryRadius(Vec2 const& center, float radius, std::vector<Entity>& out);
+		bool Raycast(Vec2 const& origin, Vec2 const& end, RaycastHit& hit);
+		size_t RaycastAll(Vec2 const& origin, Vec2 const& end, std::vector<RaycastHit>& hits);
+		bool Sweep(Entity e, Vec2 const& motion, RaycastHit& hit);
+
+		bool IsTouching(Entity a, Entity b) const;
+		void GetTouching(Entity e, std::vector<Entity>& out) const;
+
+		//manifolds of this step, one per touching solid pair, read by the solver
+		std::vector<Arbiter>& GetArbiters() { return mArbiters; }
+		CollisionProfile const& GetProfile() const { return mProfile; }
+
+		//touching pairs carried between steps, for snapshots
+		void SaveState(std::vector<ContactPair>& pairs) const;
+		void RestoreState(std::vector<ContactPair> const& pairs);
 	private:
+		void UpdateAABBCache(float dt);
+		void RunNarrowphase();
+		void DispatchContactChanges();
+		void RaycastLeaves(Vec2 const& origin, Vec2 const& end, bool firstOnly, std::vector<RaycastHit>& hits);
+		RigidBody const& GetBody(Entity e) const;
 
 		DataMgmt::Quadtree<Entity> mQuadtree;
+		//bodies that go through the quadtree, everything but the baked terrain
+		std::vector<Entity> mDynamicEntities;
+
+		//static terrain baked into merged rects, never in the quadtree
+		TerrainGrid mTerrain;
+		//rect each terrain tile was merged into, NO_TERRAIN_RECT for other entities
+		std::vector<uint32_t> mTerrainRectOf;
+		//body of each merged rect for the kernels that read a RigidBody
+		std::vector<RigidBody> mTerrainBodies;
+		size_t mTerrainTileCount{};
+
+		//aabb and pair filter of every entity in mEntities, rebuilt once per update
+		std::vector<std::pair<Vec2, Vec2>> mAABBCache;
+		std::vector<ColliderFilter> mFilterCache;
+		std::vector<NarrowBody> mBodyCache;
+		//broadphase pairs, same key as ContactPair, sorted and unique before the narrowphase
+		std::vector<uint64_t> mPairs;
+		std::vector<Arbiter> mArbiters;
+		//scratch for the batched box face test
+		BoxPairSoA mBoxPairs;
+		std::vector<uint32_t> mBoxMask;
+		//pairs touching this step and last step, sorted by key
+		std::vector<ContactPair> mCurrPairs;
+		std::vector<ContactPair> mPrevPairs;
+		//scratch for the batch overlap kernel
+		AABBSoA mBatch;
+		std::vector<uint32_t> mHitMask;
+		std::vector<Entity> mCandidates;
+		std::vector<Entity> mQueryResult;
+		std::vector<RaycastHit> mRayHits;
+		CollisionProfile mProfile;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,42 @@
+#pragma once
+/******************************************************************************/
+/*!
+\par        Image Engine
+\file       JointSystem.hpp
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief		distance, revolute and prismatic joints, solved by the physics
+			system alongside the contact arbiters
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+			or disclosure of this file or its contents without the prior
+			written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+
+#include "Core/System.hpp"
+#include <Components/RigidBody.hpp>
+#include <Components/Joint.hpp>
+#include "Math/MathUtils.h"
+#include <Core/Types.hpp>
+
+namespace Physics {
+	class JointSystem : public System
+	{
+	public:
+		void Init();
+
+		void PreStep(float invDt);
+		void ApplyImpulses();
+
+		void SaveState(std::vector<std::pair<Entity, Joint>>& out) const;
+		void RestoreState(std::vector<std::pair<Entity, Joint>> const& joints);
+	private:
+		bool GetBodies(Entity e, Joint const& joint, RigidBody*& other, RigidBody*& self);
+
+		//stands in for the other body of joints joined to the world
+		RigidBody mWorldBody{};
+	};
+}
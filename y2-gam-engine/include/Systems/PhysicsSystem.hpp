@@ -37,7 +37,40 @@
 #include <Core/Physics.hpp>
 #include <Core/Types.hpp>
 #include <Core/Event.hpp>
+#include <Components/Joint.hpp>
+#include <Systems/CollisionSystem.hpp>
 namespace Physics {
+	//time spent in the last PostCollisionUpdate
+	struct SolverProfile {
+		int64_t prestepNs{};
+		int64_t iterationsNs{};
+		int64_t integrateNs{};
+	};
+
+	//the part of a body a step changes, the rest only changes through the editor
+	struct BodyState {
+		Entity entity{};
+		Vec2 position{};
+		Vec2 velocity{};
+		Vec2 force{};
+		float rotation{};
+		float angularVelocity{};
+		float torque{};
+		bool isGrounded{};
+	};
+
+	//everything the next step reads, taken at the end of a step
+	struct PhysicsSnapshot {
+		uint64_t frame{};
+		bool isValid{ false };
+		std::vector<BodyState> bodies;
+		std::vector<std::pair<Entity, Joint>> joints;
+		std::vector<Collision::ContactPair> contacts;
+	};
+
+	//steps kept for rewinding by default, 2 seconds at 60hz
+	constexpr size_t DEFAULT_HISTORY_LENGTH{ 120 };
+
 	class PhysicsSystem : public System
 	{
 	public:
@@ -47,10 +80,25 @@ namespace Physics {
 		void PreCollisionUpdate(float dt);
 		void PostCollisionUpdate(float dt);
 
+		uint64_t HashState() const;
+		SolverProfile const& GetProfile() const { return mProfile; }
+
+		void SaveSnapshot(PhysicsSnapshot& out) const;
+		void RestoreSnapshot(PhysicsSnapshot const& snapshot);
+		//every step is saved into a ring of this many snapshots, 0 turns it off
+		void SetHistoryLength(size_t length);
+		//number of steps taken, the snapshot of a step is saved under this number
+		uint64_t GetFrame() const { return mFrame; }
+		bool Rewind(uint64_t frame);
+
 	private:
 		const size_t iterations {10}; // iterations for sequential impulse
-		ArbiterHashTable mArbiterTable;
-		void CollisionListener(Event& event);
+		SolverProfile mProfile;
+		uint64_t mFrame{};
+		std::vector<PhysicsSnapshot> mHistory{ DEFAULT_HISTORY_LENGTH };
+		//bodies whose rotation changed this step, their sin and cos are refreshed together
+		std::vector<RigidBody*> mTurnedBodies;
+		std::vector<float> mTurnedAngles, mTurnedSines, mTurnedCosines;
 	};
 	
 }
@@ -26,8 +26,12 @@
 #include "Graphics/Framebuffer.hpp"
 #include "Graphics/Texture.hpp"
 #include "Graphics/SubTexture.hpp"
+#include "Graphics/Renderer.hpp"
 #include "Components/Transform.hpp"
 #include "Components/Sprite.hpp"
+#include "Math/RadixSort.hpp"
+#include "Math/AABBBatch.hpp"
+#include "Components/OrthoCamera.hpp"
 
 class Event;
 
@@ -41,6 +45,10 @@ public:
 
 	Entity GetCamera();
 
+	static uint64_t MakeSortKey(Transform const& transform, Sprite const& sprite);
+	static void PushSpriteBounds(Transform const& transform, Collision::AABBSoA& bounds);
+	static size_t CullSprites(OrthoCamera const& camera, Collision::AABBSoA const& bounds, std::vector<uint32_t>& visibleMask);
+
 	std::shared_ptr<Framebuffer> const& GetFramebuffer() const;
 	//for debug
 	void ToggleDebugMode();
@@ -49,6 +57,10 @@ private:
 	bool mDebugMode{false};
 
 	void WindowSizeListener(Event& event);
+	void EntityListener(Event& event);
+	void CheckStaticSprites();
+	void BuildStaticSprites();
+	void CollectDynamicEntities();
 	std::shared_ptr<Framebuffer> mFramebuffer; //TEMP
 	std::shared_ptr<SubTexture> mBgSubtex; // TEMP
 
@@ -59,6 +71,31 @@ private:
 	};
 
 	std::vector<RenderEntry> mRenderQueue;
+	Collision::AABBSoA mSpriteBounds; //same order as the queue before culling
+	std::vector<uint32_t> mVisibleMask;
+	std::vector<Image::KeyIndex> mSortKeys; //sorted in place of the queue, index into it
+	std::vector<Image::KeyIndex> mSortScratch;
+	std::vector<QuadDraw> mQuadDraws;
+
+	//what a static sprite was baked with, any difference means the batches are built again
+	struct StaticEntry {
+		Entity entity;
+		Transform const* transform;
+		Sprite const* sprite;
+		uint64_t version;
+		SubTexture const* subtex;
+		glm::vec4 color;
+		Layer layer;
+	};
+
+	static constexpr size_t cLayerCount{ static_cast<size_t>(Layer::UI) + 1 };
+	std::vector<StaticEntry> mStaticEntries; //in entity order
+	std::vector<bool> mIsStaticEntity; //indexed by entity
+	std::vector<Entity> mDynamicEntities; //the entities that are not baked, the only ones queued every frame
+	std::array<StaticBatch, cLayerCount> mStaticBatches;
+	bool mIsStaticValid{ false };
+	bool mHasEntityChanges{ false }; //an entity or component was added, cloned or removed since the entities were collected
+	bool mHasMovedComponents{ false }; //an entity or component was removed, the entry pointers may be stale
 
 	Entity mCamera{};
 
@@ -0,0 +1,1856 @@
+/******************************************************************************/
+/*!
+\par        Image Engine
+\file       Benchmark.cpp
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief		headless micro benchmarks, run with --bench before any window,
+			audio or mono setup. --determinism runs the physics replay check,
+			--bench physics runs the solver scenes and can write them as json
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+			or disclosure of this file or its contents without the prior
+			written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+
+#include "../include/pch.hpp"
+
+#include <Engine/Benchmark.hpp>
+#include <Math/AABBBatch.hpp>
+#include <Math/FastTrig.hpp>
+#include <Core/Coordinator.hpp>
+#include <Components/Transform.hpp>
+#include <Components/Gravity.hpp>
+#include <Components/RigidBody.hpp>
+#include <Components/BoxCollider.hpp>
+#include <Components/Joint.hpp>
+#include <Components/Camera.hpp>
+#include <Systems/PhysicsSystem.hpp>
+#include <Systems/JointSystem.hpp>
+#include <Systems/CollisionSystem.hpp>
+#include <Core/Serialization/SerializationManager.hpp>
+#include <Graphics/Renderer.hpp>
+#include <Graphics/TextureAtlas.hpp>
+#include <Engine/StubGL.hpp>
+#include <Systems/RenderSystem.hpp>
+#include <glm/gtc/packing.hpp>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+
+namespace {
+	using BenchClock = std::chrono::high_resolution_clock;
+
+	/*  _________________________________________________________________________ */
+	/*! SecondsSince
+
+	@param start The time point to measure from.
+
+	@return The number of seconds elapsed since start.
+	*/
+	double SecondsSince(BenchClock::time_point start) {
+		return std::chrono::duration<double>(BenchClock::now() - start).count();
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! StubRenderer
+
+	StubGL installed and the renderer initialised on it for the scope of one
+	benchmark, with a unit camera to draw through. The draw callbacks a
+	benchmark sets are cleared with it, so none outlives what it reads.
+	*/
+	struct StubRenderer {
+		OrthoCamera camera{ 1.f, -1.f, 1.f, -1.f, 1.f };
+
+		/*  _________________________________________________________________________ */
+		/*! StubRenderer
+
+		@param texUnits The number of texture units the stub reports.
+		@param isMapped Report buffer storage and stream through the mapped
+		rings, else take the SetData path.
+		*/
+		explicit StubRenderer(int texUnits, bool isMapped = true) {
+			StubGL::Install(texUnits, isMapped);
+			Renderer::Init(isMapped);
+		}
+		~StubRenderer() {
+			StubGL::State& gl{ StubGL::GetState() };
+			gl.onDraw = nullptr;
+			gl.onInstancedDraw = nullptr;
+			Renderer::Shutdown();
+		}
+		StubRenderer(StubRenderer const&) = delete;
+		StubRenderer& operator=(StubRenderer const&) = delete;
+	};
+
+	/*  _________________________________________________________________________ */
+	/*! SetupPhysicsWorld
+
+	@return none.
+
+	Registers the components and systems the physics benchmarks need, with
+	the same signatures as main. Only done once per process since the
+	coordinator does not allow registering twice.
+	*/
+	void SetupPhysicsWorld() {
+		static bool isSetup{ false };
+		if (isSetup) return;
+		isSetup = true;
+
+		using namespace Physics;
+		using namespace Collision;
+		std::shared_ptr<Coordinator> coordinator{ Coordinator::GetInstance() };
+		coordinator->Init();
+		coordinator->RegisterComponent<Transform>();
+		coordinator->RegisterComponent<Gravity>();
+		coordinator->RegisterComponent<RigidBody>();
+		coordinator->RegisterComponent<BoxCollider>();
+		coordinator->RegisterComponent<Joint>();
+
+		coordinator->RegisterSystem<PhysicsSystem>();
+		{
+			Signature signature;
+			signature.set(coordinator->GetComponentType<Gravity>());
+			signature.set(coordinator->GetComponentType<RigidBody>());
+			coordinator->SetSystemSignature<PhysicsSystem>(signature);
+		}
+		coordinator->GetSystem<PhysicsSystem>()->Init();
+
+		coordinator->RegisterSystem<JointSystem>();
+		{
+			Signature signature;
+			signature.set(coordinator->GetComponentType<Joint>());
+			signature.set(coordinator->GetComponentType<RigidBody>());
+			coordinator->SetSystemSignature<JointSystem>(signature);
+		}
+		coordinator->GetSystem<JointSystem>()->Init();
+
+		coordinator->RegisterSystem<CollisionSystem>();
+		{
+			Signature signature;
+			signature.set(coordinator->GetComponentType<RigidBody>());
+			signature.set(coordinator->GetComponentType<BoxCollider>());
+			coordinator->SetSystemSignature<CollisionSystem>(signature);
+		}
+		coordinator->GetSystem<CollisionSystem>()->Init();
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! SpawnBody
+
+	@param pos The position of the body.
+	@param dim The dimensions of the body.
+	@param mass The mass of the body, FLOAT_MAX for static.
+	@param gravity The gravity applied to the body.
+
+	@return Entity The new entity.
+
+	Creates a box body the same way the editor does.
+	*/
+	Entity SpawnBody(Vec2 const& pos, Vec2 const& dim, float mass, Vec2 const& gravity) {
+		std::shared_ptr<Coordinator> coordinator{ Coordinator::GetInstance() };
+		Entity e{ coordinator->CreateEntity() };
+		coordinator->AddComponent(e, RigidBody{ pos, 0.f, mass, dim });
+		coordinator->AddComponent(e, Gravity{ gravity });
+		coordinator->AddComponent(e, BoxCollider{});
+		coordinator->AddComponent(e, Transform{ { pos.x, pos.y, 0.f }, { 0.f, 0.f, 0.f }, { dim.x, dim.y, 1.f } });
+		return e;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! StepPhysicsWorld
+
+	@param dt The fixed time step.
+
+	@return none.
+
+	One physics step in the same order as MainState.
+	*/
+	void StepPhysicsWorld(float dt) {
+		std::shared_ptr<Coordinator> coordinator{ Coordinator::GetInstance() };
+		coordinator->GetSystem<Physics::PhysicsSystem>()->PreCollisionUpdate(dt);
+		coordinator->GetSystem<Collision::CollisionSystem>()->Update(dt);
+		coordinator->GetSystem<Physics::PhysicsSystem>()->PostCollisionUpdate(dt);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! ClearPhysicsWorld
+
+	@param entities The entities to destroy, cleared afterwards.
+
+	@return none.
+	*/
+	void ClearPhysicsWorld(std::vector<Entity>& entities) {
+		for (auto const& e : entities) Coordinator::GetInstance()->DestroyEntity(e);
+		entities.clear();
+	}
+
+	//ns per step of each physics stage over the measured steps of a scene
+	struct PhysicsSceneResult {
+		std::string name;
+		size_t bodies{};
+		int steps{};
+		double broadphaseNs{}, narrowphaseNs{}, prestepNs{}, iterationsNs{}, integrateNs{}, totalNs{};
+	};
+
+	/*  _________________________________________________________________________ */
+	/*! MeasurePhysicsScene
+
+	@param name The name the scene is reported under.
+	@param entities The entities of the scene, destroyed afterwards.
+	@param warmup The number of steps run before measuring, so piles have
+	settled into their steady state contacts.
+	@param steps The number of measured steps.
+
+	@return PhysicsSceneResult The average cost of each stage per step.
+	*/
+	PhysicsSceneResult MeasurePhysicsScene(std::string const& name, std::vector<Entity>& entities, int warmup, int steps) {
+		std::shared_ptr<Coordinator> coordinator{ Coordinator::GetInstance() };
+		auto collisionSystem{ coordinator->GetSystem<Collision::CollisionSystem>() };
+		auto physicsSystem{ coordinator->GetSystem<Physics::PhysicsSystem>() };
+		constexpr float dt{ 1.f / 60.f };
+
+		collisionSystem->BakeTerrain();
+		for (int i{}; i < warmup; ++i) StepPhysicsWorld(dt);
+
+		PhysicsSceneResult result{ name, entities.size(), steps };
+		int64_t broadphase{}, narrowphase{}, prestep{}, iterations{}, integrate{};
+		auto start{ BenchClock::now() };
+		for (int i{}; i < steps; ++i) {
+			StepPhysicsWorld(dt);
+			broadphase += collisionSystem->GetProfile().broadphaseNs;
+			narrowphase += collisionSystem->GetProfile().narrowphaseNs;
+			prestep += physicsSystem->GetProfile().prestepNs;
+			iterations += physicsSystem->GetProfile().iterationsNs;
+			integrate += physicsSystem->GetProfile().integrateNs;
+		}
+		result.totalNs = SecondsSince(start) * 1e9 / steps;
+		result.broadphaseNs = static_cast<double>(broadphase) / steps;
+		result.narrowphaseNs = static_cast<double>(narrowphase) / steps;
+		result.prestepNs = static_cast<double>(prestep) / steps;
+		result.iterationsNs = static_cast<double>(iterations) / steps;
+		result.integrateNs = static_cast<double>(integrate) / steps;
+		ClearPhysicsWorld(entities);
+		return result;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! SpawnGround
+
+	@param entities The scene to add the ground to.
+
+	@return none.
+
+	A static floor across the whole world just above the bottom limit.
+	*/
+	void SpawnGround(std::vector<Entity>& entities) {
+		Entity e{ SpawnBody({ 0.f, -120.f }, { 250.f, 5.f }, FLOAT_MAX, { 0.f, 0.f }) };
+		Coordinator::GetInstance()->GetComponent<BoxCollider>(e).category = CollisionLayer::STATIC;
+		entities.emplace_back(e);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! SpawnPrefabBody
+
+	@param prefab The prefab object from Prefabs.json.
+	@param pos Where to place the body.
+
+	@return Entity The new entity.
+
+	Builds only the physics components of the prefab, the rest need the
+	graphics and scripting systems the benchmark does not register.
+	*/
+	Entity SpawnPrefabBody(rapidjson::Value const& prefab, Vec2 const& pos) {
+		std::shared_ptr<Coordinator> coordinator{ Coordinator::GetInstance() };
+		Entity e{ coordinator->CreateEntity() };
+		RigidBody rb{ prefab["RigidBody"] };
+		rb.position = pos;
+		Transform transform{ prefab["Transform"] };
+		transform.position = { pos.x, pos.y, 0.f };
+		coordinator->AddComponent(e, rb);
+		coordinator->AddComponent(e, Gravity{ prefab["Gravity"] });
+		coordinator->AddComponent(e, BoxCollider{ prefab["BoxCollider"] });
+		coordinator->AddComponent(e, transform);
+		return e;
+	}
+}
+
+namespace Benchmark {
+	/*  _________________________________________________________________________ */
+	/*! Run
+
+	@param argc The argument count passed to main.
+	@param argv The arguments passed to main.
+	@param exitCode Set to what the process should exit with, 1 if any
+	check of the benchmarks that ran failed, else 0.
+
+	@return true if a benchmark was requested and ran, in which case the
+	engine should exit with exitCode instead of opening a window.
+
+	Usage: --bench [aabb|query|ccd|physics|math|quads|texslots|mapped|queue|cull|instancing|static|atlas] [out.json]. no name runs every
+	benchmark, the json path is only used by physics. Every check prints
+	MISMATCH when it fails.
+	--determinism [frames] runs the replay check, 600 frames by default, and
+	exits with 1 if the two runs differ.
+	*/
+	bool Run(int argc, char* argv[], int& exitCode) {
+		exitCode = 0;
+		int benchArg{ -1 };
+		for (int i{ 1 }; i < argc; ++i) {
+			if (std::strcmp(argv[i], "--bench") == 0) benchArg = i;
+			if (std::strcmp(argv[i], "--determinism") == 0) {
+				int frames{ i + 1 < argc ? std::atoi(argv[i + 1]) : 0 };
+				if (!RunDeterminism(frames > 0 ? frames : 600)) exitCode = 1;
+				return true;
+			}
+		}
+		if (benchArg < 0) return false;
+
+		const char* which{ benchArg + 1 < argc ? argv[benchArg + 1] : "all" };
+		bool all{ std::strcmp(which, "all") == 0 };
+		bool passed{ true };
+		if (all || std::strcmp(which, "aabb") == 0) passed = RunAABBBatch() && passed;
+		if (all || std::strcmp(which, "query") == 0) passed = RunSpatialQueries() && passed;
+		if (all || std::strcmp(which, "ccd") == 0) passed = RunContinuousCollision() && passed;
+		if (all || std::strcmp(which, "math") == 0) RunMathKernels();
+		if (all || std::strcmp(which, "quads") == 0) passed = RunQuadVertices() && passed;
+		if (all || std::strcmp(which, "texslots") == 0) passed = RunTextureSlots() && passed;
+		if (all || std::strcmp(which, "mapped") == 0) passed = RunMappedRing() && passed;
+		if (all || std::strcmp(which, "queue") == 0) passed = RunRenderQueue() && passed;
+		if (all || std::strcmp(which, "cull") == 0) passed = RunSpriteCulling() && passed;
+		if (all || std::strcmp(which, "instancing") == 0) passed = RunInstancing() && passed;
+		if (all || std::strcmp(which, "static") == 0) passed = RunStaticBatches() && passed;
+		if (all || std::strcmp(which, "atlas") == 0) passed = RunTextureAtlas() && passed;
+		if (all || std::strcmp(which, "physics") == 0) {
+			RunPhysicsScenes(benchArg + 2 < argc ? argv[benchArg + 2] : nullptr);
+		}
+		if (!passed) exitCode = 1;
+		return true;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! RunAABBBatch
+
+	@return true if every check passed.
+
+	Tests one query box against a soa block of 10000 random boxes with each
+	instruction set the machine supports and prints the number of overlap
+	tests per second. also checks every isa produces the same hits as the
+	scalar path.
+	*/
+	bool RunAABBBatch() {
+		using namespace Collision;
+		constexpr size_t boxCount{ 10000 };
+		constexpr size_t queryCount{ 256 };
+		constexpr int repeats{ 200 };
+
+		std::mt19937 rng{ 1234 };
+		std::uniform_real_distribution<float> posDist{ -1000.f, 1000.f };
+		std::uniform_real_distribution<float> sizeDist{ 1.f, 40.f };
+
+		AABBSoA soa;
+		soa.Reserve(boxCount);
+		for (size_t i{}; i < boxCount; ++i) {
+			Vec2 min{ posDist(rng), posDist(rng) };
+			soa.Push(min, Vec2{ min.x + sizeDist(rng), min.y + sizeDist(rng) });
+		}
+		std::vector<std::pair<Vec2, Vec2>> queries;
+		for (size_t i{}; i < queryCount; ++i) {
+			Vec2 min{ posDist(rng), posDist(rng) };
+			queries.emplace_back(min, Vec2{ min.x + sizeDist(rng) * 4.f, min.y + sizeDist(rng) * 4.f });
+		}
+
+		std::vector<uint32_t> mask(AABBMaskWords(boxCount)), reference(AABBMaskWords(boxCount));
+		bool passed{ true };
+		std::cout << "[bench] aabb batch: " << boxCount << " boxes x " << queryCount << " queries, best isa "
+			<< GetSimdIsaName(GetBestSimdIsa()) << "\n";
+
+		for (SimdIsa isa : { SimdIsa::SCALAR, SimdIsa::SSE, SimdIsa::AVX2 }) {
+			if (!IsSimdIsaSupported(isa)) {
+				std::cout << "  " << GetSimdIsaName(isa) << ": unsupported\n";
+				continue;
+			}
+
+			bool match{ true };
+			for (auto const& q : queries) {
+				OverlapBatch(SimdIsa::SCALAR, q.first, q.second, soa, 0, boxCount, reference.data());
+				OverlapBatch(isa, q.first, q.second, soa, 0, boxCount, mask.data());
+				match = match && mask == reference;
+			}
+
+			size_t hits{};
+			auto start{ BenchClock::now() };
+			for (int r{}; r < repeats; ++r) {
+				for (auto const& q : queries) {
+					hits += OverlapBatch(isa, q.first, q.second, soa, 0, boxCount, mask.data());
+				}
+			}
+			double seconds{ SecondsSince(start) };
+			double tests{ static_cast<double>(boxCount) * queryCount * repeats };
+
+			std::cout << "  " << GetSimdIsaName(isa) << ": " << tests / seconds / 1e6 << " M tests/s, "
+				<< hits << " hits" << (match ? "" : ", MISMATCH vs scalar") << "\n";
+			passed = passed && match;
+		}
+		return passed;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! RunSpatialQueries
+
+	@return true if every check passed.
+
+	Fills the world with MAX_ENTITIES small boxes, builds the broadphase once
+	and prints the average latency of each CollisionSystem query, next to a
+	brute force region query over every body for reference. Then checks a
+	flat circle's bounds, the polygon winding checks and that destroyed
+	bodies leave the region query right away.
+	*/
+	bool RunSpatialQueries() {
+		using namespace Collision;
+		SetupPhysicsWorld();
+		std::shared_ptr<Coordinator> coordinator{ Coordinator::GetInstance() };
+		auto collisionSystem{ coordinator->GetSystem<CollisionSystem>() };
+
+		constexpr int queryCount{ 10000 };
+		float limitX{ static_cast<float>(WORLD_LIMIT_X) - 2.f }, limitY{ static_cast<float>(WORLD_LIMIT_Y) - 2.f };
+		std::mt19937 rng{ 42 };
+		std::uniform_real_distribution<float> xDist{ -limitX, limitX }, yDist{ -limitY, limitY };
+		std::uniform_real_distribution<float> sizeDist{ .5f, 2.f };
+
+		std::vector<Entity> entities;
+		for (size_t i{}; i < MAX_ENTITIES; ++i) {
+			entities.emplace_back(SpawnBody({ xDist(rng), yDist(rng) }, { sizeDist(rng), sizeDist(rng) }, FLOAT_MAX, { 0.f, 0.f }));
+		}
+		collisionSystem->Update(0.f);
+
+		std::vector<Vec2> points;
+		for (int i{}; i < queryCount; ++i) points.emplace_back(xDist(rng), yDist(rng));
+
+		std::vector<Entity> out;
+		size_t results{};
+		auto start{ BenchClock::now() };
+		for (auto const& p : points) {
+			collisionSystem->QueryAABB(p - 4.f, p + 4.f, out);
+			results += out.size();
+		}
+		double aabbSeconds{ SecondsSince(start) };
+		std::cout << "[bench] spatial queries: " << entities.size() << " bodies, " << queryCount << " queries each\n";
+		std::cout << "  QueryAABB 8x8: " << aabbSeconds / queryCount * 1e6 << " us/query, " << results << " results\n";
+
+		//brute force is only run on a slice, it is too slow to do every query
+		constexpr int bruteCount{ 100 };
+		size_t sliceResults{};
+		for (int i{}; i < bruteCount; ++i) {
+			collisionSystem->QueryAABB(points[i] - 4.f, points[i] + 4.f, out);
+			sliceResults += out.size();
+		}
+		results = 0;
+		start = BenchClock::now();
+		for (int i{}; i < bruteCount; ++i) {
+			Vec2 min{ points[i] - 4.f }, max{ points[i] + 4.f };
+			for (auto const& e : entities) {
+				auto aabb{ GetAABBBody(coordinator->GetComponent<RigidBody>(e), coordinator->GetComponent<BoxCollider>(e).shape) };
+				if (aabb.first.x < max.x && aabb.second.x > min.x && aabb.first.y < max.y && aabb.second.y > min.y) ++results;
+			}
+		}
+		double bruteSeconds{ SecondsSince(start) };
+		bool passed{ results == sliceResults };
+		std::cout << "  brute force 8x8: " << bruteSeconds / bruteCount * 1e6 << " us/query, " << results << " results"
+			<< (passed ? "" : ", MISMATCH vs QueryAABB") << "\n";
+
+		results = 0;
+		start = BenchClock::now();
+		for (auto const& p : points) {
+			collisionSystem->QueryRadius(p, 4.f, out);
+			results += out.size();
+		}
+		std::cout << "  QueryRadius r=4: " << SecondsSince(start) / queryCount * 1e6 << " us/query, " << results << " results\n";
+
+		results = 0;
+		RaycastHit hit{};
+		start = BenchClock::now();
+		for (auto const& p : points) {
+			results += collisionSystem->Raycast(p, p + Vec2{ 60.f, -30.f }, hit) ? 1 : 0;
+		}
+		std::cout << "  Raycast len 67 (first hit): " << SecondsSince(start) / queryCount * 1e6 << " us/query, " << results << " hits\n";
+
+		std::vector<RaycastHit> hits;
+		results = 0;
+		start = BenchClock::now();
+		for (auto const& p : points) {
+			results += collisionSystem->RaycastAll(p, p + Vec2{ 60.f, -30.f }, hits);
+		}
+		std::cout << "  RaycastAll len 67: " << SecondsSince(start) / queryCount * 1e6 << " us/query, " << results << " hits\n";
+
+		ClearPhysicsWorld(entities);
+
+		//a flat circle still has a square aabb, a query just under its top finds it
+		entities.emplace_back(SpawnBody({ 0.f, 0.f }, { 4.f, 1.f }, FLOAT_MAX, { 0.f, 0.f }));
+		coordinator->GetComponent<BoxCollider>(entities.back()).shape = ColliderShape::CIRCLE;
+		collisionSystem->Update(0.f);
+		collisionSystem->QueryAABB({ -.1f, 1.7f }, { .1f, 1.9f }, out);
+		bool circleFound{ std::find(out.begin(), out.end(), entities.back()) != out.end() };
+
+		//clockwise polygons are rewound, concave ones fall back to the box
+		Vec2 const clockwise[3]{ { -.5f, -.5f }, { 0.f, .5f }, { .5f, -.5f } };
+		Vec2 const concave[4]{ { -.5f, -.5f }, { .5f, -.5f }, { 0.f, 0.f }, { 0.f, .5f } };
+		BoxCollider rewound{}, rejected{};
+		rewound.SetPolygon(clockwise, 3);
+		rejected.SetPolygon(concave, 4);
+		bool isRewound{ rewound.shape == ColliderShape::POLYGON && cross(rewound.vertices[1] - rewound.vertices[0], rewound.vertices[2] - rewound.vertices[1]) > 0.f };
+		bool isRejected{ rejected.shape == ColliderShape::BOX };
+		std::cout << "  shapes: flat circle " << (circleFound ? "found" : "missed") << " by its aabb, clockwise polygon "
+			<< (isRewound ? "rewound" : "kept") << ", concave polygon " << (isRejected ? "rejected" : "kept")
+			<< (circleFound && isRewound && isRejected ? ", MATCH" : ", MISMATCH") << "\n";
+		passed = passed && circleFound && isRewound && isRejected;
+
+		//destroyed bodies and terrain tiles are gone before the next Update rebuilds the tree
+		entities.emplace_back(SpawnBody({ 10.f, 0.f }, { 2.f, 2.f }, FLOAT_MAX, { 0.f, 0.f }));
+		coordinator->GetComponent<BoxCollider>(entities.back()).category = CollisionLayer::STATIC;
+		collisionSystem->BakeTerrain();
+		collisionSystem->Update(0.f);
+		ClearPhysicsWorld(entities);
+		collisionSystem->QueryAABB({ -3.f, -3.f }, { 12.f, 3.f }, out);
+		std::cout << "  destroyed circle and terrain tile: " << out.size() << " returned before the next Update"
+			<< (out.empty() ? ", MATCH" : ", MISMATCH") << "\n";
+		return passed && out.empty();
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! RunContinuousCollision
+
+	@return true if every check passed.
+
+	Fires small bodies at a 5 unit thick static wall fast enough to cross it
+	in one 60hz step, once as plain bodies and once flagged as bullets, and
+	prints how many ended up on the far side and the cost per step. Then
+	fires bullets whose mask leaves out the wall's category, which should
+	all pass through it at full speed.
+	*/
+	bool RunContinuousCollision() {
+		SetupPhysicsWorld();
+		std::shared_ptr<Coordinator> coordinator{ Coordinator::GetInstance() };
+		constexpr int bodyCount{ 200 };
+		constexpr int steps{ 10 };
+		constexpr float dt{ 1.f / 60.f };
+		constexpr float speed{ 3000.f };
+
+		bool passed{ true };
+		std::cout << "[bench] ccd: " << bodyCount << " bodies at " << speed << " u/s into a 5 unit wall, "
+			<< speed * dt << " units per step\n";
+		for (int run{}; run < 3; ++run) {
+			bool isBullet{ run > 0 }, isMasked{ run == 2 };
+			std::vector<Entity> entities;
+			entities.emplace_back(SpawnBody({ 0.f, 0.f }, { 5.f, 250.f }, FLOAT_MAX, { 0.f, 0.f }));
+			coordinator->GetComponent<BoxCollider>(entities.back()).category = CollisionLayer::STATIC;
+			for (int i{}; i < bodyCount; ++i) {
+				Vec2 pos{ -60.f - static_cast<float>(i % 7) * 3.f, -100.f + static_cast<float>(i) };
+				Entity e{ SpawnBody(pos, { .8f, .8f }, 1.f, { 0.f, 0.f }) };
+				auto& rb{ coordinator->GetComponent<RigidBody>(e) };
+				rb.velocity = Vec2{ speed, 0.f };
+				rb.isLockRotation = true;
+				rb.isBullet = isBullet;
+				if (isMasked) coordinator->GetComponent<BoxCollider>(e).mask = CollisionLayer::ALL & ~CollisionLayer::STATIC;
+				entities.emplace_back(e);
+			}
+
+			auto start{ BenchClock::now() };
+			for (int i{}; i < steps; ++i) StepPhysicsWorld(dt);
+			double seconds{ SecondsSince(start) };
+
+			int tunnelled{}, fullSpeed{};
+			for (size_t i{ 1 }; i < entities.size(); ++i) {
+				auto const& rb{ coordinator->GetComponent<RigidBody>(entities[i]) };
+				if (rb.position.x > 0.f) ++tunnelled;
+				if (rb.velocity.x == speed) ++fullSpeed;
+			}
+			//plain bodies are expected to tunnel, that is what bullets are for
+			bool isExpected{ isMasked ? tunnelled == bodyCount && fullSpeed == bodyCount : !isBullet || tunnelled == 0 };
+			if (isMasked) {
+				std::cout << "  bullet, wall masked out: " << tunnelled << "/" << bodyCount << " passed through, "
+					<< fullSpeed << " at full speed, " << seconds / steps * 1e3 << " ms/step" << (isExpected ? "" : ", MISMATCH") << "\n";
+			}
+			else {
+				std::cout << "  " << (isBullet ? "bullet" : "discrete") << ": " << tunnelled << "/" << bodyCount
+					<< " tunnelled, " << seconds / steps * 1e3 << " ms/step" << (isExpected ? "" : ", MISMATCH") << "\n";
+			}
+			passed = passed && isExpected;
+			ClearPhysicsWorld(entities);
+		}
+		return passed;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! RunDeterminism
+
+	@param frames The number of fixed steps to run the scene for.
+
+	@return bool true if both runs ended in the same state.
+
+	Builds a seeded scene with baked terrain, a pile of every collider shape,
+	bullets and a trigger, steps it headlessly and hashes every body. The
+	scene is run twice in the same process and the hashes compared, the
+	printed hash can also be compared between builds and machines. A third
+	run rewinds to the middle through the physics history and replays the
+	rest, which has to end on the same hash.
+	*/
+	bool RunDeterminism(int frames) {
+		using namespace Collision;
+		SetupPhysicsWorld();
+		std::shared_ptr<Coordinator> coordinator{ Coordinator::GetInstance() };
+		constexpr float dt{ 1.f / 60.f };
+		Vec2 const gravity{ 0.f, -100.f };
+		constexpr int pileCount{ 300 };
+
+		auto runScene = [&](int rewindFrame) {
+			std::vector<Entity> entities;
+			std::mt19937 rng{ 2023 };
+			std::uniform_real_distribution<float> sizeDist{ 1.f, 3.f };
+			std::uniform_real_distribution<float> jitterDist{ -.2f, .2f };
+
+			//floor and walls out of 2 unit tiles so the terrain bake merges them
+			for (int i{}; i < 100; ++i) {
+				entities.emplace_back(SpawnBody({ -99.f + i * 2.f, -110.f }, { 2.f, 2.f }, FLOAT_MAX, gravity));
+			}
+			for (int i{}; i < 40; ++i) {
+				entities.emplace_back(SpawnBody({ -101.f, -107.f + i * 2.f }, { 2.f, 2.f }, FLOAT_MAX, gravity));
+				entities.emplace_back(SpawnBody({ 101.f, -107.f + i * 2.f }, { 2.f, 2.f }, FLOAT_MAX, gravity));
+			}
+			for (auto const& e : entities) coordinator->GetComponent<BoxCollider>(e).category = CollisionLayer::STATIC;
+
+			Vec2 const triangle[3]{ { -.5f, -.5f }, { .5f, -.5f }, { 0.f, .5f } };
+			for (int i{}; i < pileCount; ++i) {
+				Vec2 pos{ -90.f + (i % 30) * 6.f + jitterDist(rng), -100.f + (i / 30) * 6.f };
+				float size{ sizeDist(rng) };
+				Entity e{ SpawnBody(pos, { size, size * .8f }, size, gravity) };
+				auto& rb{ coordinator->GetComponent<RigidBody>(e) };
+				auto& collider{ coordinator->GetComponent<BoxCollider>(e) };
+				rb.rotation = jitterDist(rng);
+				switch (i % 4) {
+				case 1: collider.shape = ColliderShape::CIRCLE; break;
+				case 2: collider.shape = ColliderShape::CAPSULE; break;
+				case 3: collider.SetPolygon(triangle, 3); break;
+				default: break;
+				}
+				entities.emplace_back(e);
+			}
+			for (int i{}; i < 10; ++i) {
+				Entity e{ SpawnBody({ -95.f, -60.f + i * 3.f }, { .5f, .5f }, .5f, { 0.f, 0.f }) };
+				auto& rb{ coordinator->GetComponent<RigidBody>(e) };
+				rb.isBullet = true;
+				rb.velocity = Vec2{ 1500.f, -200.f };
+				entities.emplace_back(e);
+			}
+			Entity trigger{ SpawnBody({ 0.f, -80.f }, { 40.f, 10.f }, FLOAT_MAX, gravity) };
+			coordinator->GetComponent<BoxCollider>(trigger).isTrigger = true;
+			entities.emplace_back(trigger);
+
+			auto physicsSystem{ coordinator->GetSystem<Physics::PhysicsSystem>() };
+			coordinator->GetSystem<CollisionSystem>()->BakeTerrain();
+			physicsSystem->SetHistoryLength(Physics::DEFAULT_HISTORY_LENGTH);
+			uint64_t firstFrame{ physicsSystem->GetFrame() };
+			auto start{ BenchClock::now() };
+			for (int i{}; i < frames; ++i) StepPhysicsWorld(dt);
+			double seconds{ SecondsSince(start) };
+
+			if (rewindFrame > 0) {
+				//the last step was already saved by the solver, this only times a save and a restore
+				Physics::PhysicsSnapshot snapshot;
+				physicsSystem->SaveSnapshot(snapshot);
+				auto saveStart{ BenchClock::now() };
+				physicsSystem->SaveSnapshot(snapshot);
+				double saveSeconds{ SecondsSince(saveStart) };
+
+				uint64_t target{ firstFrame + static_cast<uint64_t>(rewindFrame) };
+				auto restoreStart{ BenchClock::now() };
+				bool isRewound{ physicsSystem->Rewind(target) };
+				double restoreSeconds{ SecondsSince(restoreStart) };
+				if (!isRewound) std::cout << "  step " << rewindFrame << " is no longer in the history\n";
+				for (int i{ rewindFrame }; isRewound && i < frames; ++i) StepPhysicsWorld(dt);
+				std::cout << "  rewound " << frames - rewindFrame << " steps, save " << saveSeconds * 1e6
+					<< " us, restore " << restoreSeconds * 1e6 << " us\n";
+			}
+
+			uint64_t hash{ physicsSystem->HashState() };
+			std::cout << "  hash " << std::hex << hash << std::dec << ", " << seconds / frames * 1e3 << " ms/step\n";
+			ClearPhysicsWorld(entities);
+			return hash;
+		};
+
+		std::cout << "[determinism] " << pileCount << " bodies on baked terrain, " << frames << " frames\n";
+		uint64_t first{ runScene(0) };
+		uint64_t second{ runScene(0) };
+		//rewind as far back as the history allows
+		int rewindFrame{ std::max(frames - static_cast<int>(Physics::DEFAULT_HISTORY_LENGTH) + 1, frames / 2) };
+		uint64_t replayed{ runScene(rewindFrame) };
+		bool match{ first == second && first == replayed };
+		std::cout << "  " << (match ? "MATCH" : "MISMATCH, physics is not reproducible") << "\n";
+		return match;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! RunPhysicsScenes
+
+	@param jsonPath Where to write the results for ci, nullptr to only print.
+
+	@return none.
+
+	Steps a set of fixed scenes headlessly and prints the ns per step spent
+	in broadphase, narrowphase, prestep, solver iterations and integration.
+	pyramid is a deep stack of resting contacts, rain is 2500 boxes landing
+	on a floor, scatter is sparse bodies that rarely touch and prefabs is a
+	staircase of the Platform prefab with Box prefabs dropped on it.
+	*/
+	void RunPhysicsScenes(const char* jsonPath) {
+		SetupPhysicsWorld();
+		std::shared_ptr<Coordinator> coordinator{ Coordinator::GetInstance() };
+		Vec2 const gravity{ 0.f, -100.f };
+		constexpr int warmup{ 60 };
+		constexpr int steps{ 300 };
+		std::vector<PhysicsSceneResult> results;
+		std::vector<Entity> entities;
+
+		constexpr int pyramidRows{ 20 };
+		SpawnGround(entities);
+		for (int row{}; row < pyramidRows; ++row) {
+			int count{ pyramidRows - row };
+			for (int i{}; i < count; ++i) {
+				Vec2 pos{ (i - (count - 1) * .5f) * 4.2f, -115.5f + row * 4.f };
+				entities.emplace_back(SpawnBody(pos, { 4.f, 4.f }, 1.f, gravity));
+			}
+		}
+		results.emplace_back(MeasurePhysicsScene("pyramid", entities, warmup, steps));
+
+		constexpr int rainSide{ 50 };
+		SpawnGround(entities);
+		for (int y{}; y < rainSide; ++y) {
+			for (int x{}; x < rainSide; ++x) {
+				Vec2 pos{ -110.25f + x * 4.5f, -100.f + y * 4.5f };
+				entities.emplace_back(SpawnBody(pos, { 1.5f, 1.5f }, 1.f, gravity));
+			}
+		}
+		results.emplace_back(MeasurePhysicsScene("rain", entities, warmup, steps));
+
+		{
+			constexpr int scatterCount{ 1000 };
+			std::mt19937 rng{ 7 };
+			std::uniform_real_distribution<float> posDist{ -115.f, 115.f };
+			std::uniform_real_distribution<float> velDist{ -20.f, 20.f };
+			//walls keep the bodies inside the world limits
+			SpawnGround(entities);
+			entities.emplace_back(SpawnBody({ 0.f, 120.f }, { 250.f, 5.f }, FLOAT_MAX, { 0.f, 0.f }));
+			entities.emplace_back(SpawnBody({ -120.f, 0.f }, { 5.f, 235.f }, FLOAT_MAX, { 0.f, 0.f }));
+			entities.emplace_back(SpawnBody({ 120.f, 0.f }, { 5.f, 235.f }, FLOAT_MAX, { 0.f, 0.f }));
+			for (int i{}; i < scatterCount; ++i) {
+				Entity e{ SpawnBody({ posDist(rng), posDist(rng) }, { 1.f, 1.f }, 1.f, { 0.f, 0.f }) };
+				coordinator->GetComponent<RigidBody>(e).velocity = Vec2{ velDist(rng), velDist(rng) };
+				entities.emplace_back(e);
+			}
+			results.emplace_back(MeasurePhysicsScene("scatter", entities, warmup, steps));
+		}
+
+		std::shared_ptr<Serializer::SerializationManager> sm{ Serializer::SerializationManager::GetInstance() };
+		if (sm->OpenJSON("Prefabs") && sm->At("Prefabs", "Prefabs").IsObject()
+			&& sm->At("Prefabs", "Prefabs").HasMember("Platform") && sm->At("Prefabs", "Prefabs").HasMember("Box")) {
+			auto const& platform{ sm->At("Prefabs", "Prefabs")["Platform"] };
+			auto const& box{ sm->At("Prefabs", "Prefabs")["Box"] };
+			SpawnGround(entities);
+			//4 tiers of 3 platforms, every tier shifted so boxes spill onto the next
+			for (int tier{}; tier < 4; ++tier) {
+				for (int i{}; i < 3; ++i) {
+					Vec2 pos{ -70.f + i * 70.f + (tier % 2) * 20.f, -90.f + tier * 45.f };
+					entities.emplace_back(SpawnPrefabBody(platform, pos));
+					for (int b{}; b < 12; ++b) {
+						Vec2 boxPos{ pos.x - 15.f + (b % 4) * 10.f, pos.y + 8.f + (b / 4) * 7.f };
+						entities.emplace_back(SpawnPrefabBody(box, boxPos));
+					}
+				}
+			}
+			results.emplace_back(MeasurePhysicsScene("prefabs", entities, warmup, steps));
+		}
+		else {
+			std::cout << "[bench] physics: Data/Prefabs.json has no Platform and Box prefabs, skipping prefabs scene\n";
+		}
+
+		std::cout << "[bench] physics: " << warmup << " warmup + " << steps << " measured steps per scene, ns/step\n";
+		auto const flags{ std::cout.flags() };
+		auto const precision{ std::cout.precision() };
+		std::cout << std::fixed << std::setprecision(0);
+		for (auto const& r : results) {
+			std::cout << "  " << r.name << " (" << r.bodies << " bodies): broadphase " << r.broadphaseNs
+				<< ", narrowphase " << r.narrowphaseNs << ", prestep " << r.prestepNs
+				<< ", iterations " << r.iterationsNs << ", integrate " << r.integrateNs
+				<< ", total " << r.totalNs << "\n";
+		}
+		std::cout.flags(flags);
+		std::cout.precision(precision);
+
+		if (!jsonPath) return;
+		std::ofstream out{ jsonPath };
+		if (!out) {
+			std::cout << "[bench] physics: could not open " << jsonPath << "\n";
+			return;
+		}
+		out << std::fixed << std::setprecision(0) << "{\n  \"scenes\": [\n";
+		for (size_t i{}; i < results.size(); ++i) {
+			auto const& r{ results[i] };
+			out << "    { \"name\": \"" << r.name << "\", \"bodies\": " << r.bodies << ", \"steps\": " << r.steps
+				<< ", \"broadphase_ns\": " << r.broadphaseNs << ", \"narrowphase_ns\": " << r.narrowphaseNs
+				<< ", \"prestep_ns\": " << r.prestepNs << ", \"iterations_ns\": " << r.iterationsNs
+				<< ", \"integrate_ns\": " << r.integrateNs << ", \"total_ns\": " << r.totalNs << " }"
+				<< (i + 1 < results.size() ? "," : "") << "\n";
+		}
+		out << "  ]\n}\n";
+		std::cout << "  written to " << jsonPath << "\n";
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! RunMathKernels
+
+	@return none.
+
+	Times the math the physics inner loops lean on, in isolation: the
+	contact impulse update from ArbiterApplyImpulse, rotating points by a
+	Mat22, chaining Mat44 products and transforming a batch of points by
+	one Mat44 one at a time and with Mat44TransformPoints, and the sin/cos
+refresh of body rotations against sinf/cosf. Prints ns per
+	item and a checksum so the work cannot be optimised away.
+	*/
+	void RunMathKernels() {
+		constexpr size_t count{ 4096 };
+		constexpr int repeats{ 500 };
+		std::mt19937 rng{ 99 };
+		std::uniform_real_distribution<float> dist{ -1.f, 1.f };
+
+		struct KernelContact { Vec2 r1, r2, normal; float massNormal, massTangent, accNormal, accTangent; };
+		std::vector<KernelContact> contacts(count);
+		std::vector<Vec2> points(count), rotated(count), velocities(count + 1);
+		std::vector<float> spins(count + 1);
+		for (size_t i{}; i < count; ++i) {
+			contacts[i] = KernelContact{ { dist(rng), dist(rng) }, { dist(rng), dist(rng) }, normalized(Vec2{ dist(rng), dist(rng) + 2.f }),
+				1.f, 1.f, 0.f, 0.f };
+			points[i] = Vec2{ dist(rng), dist(rng) };
+			velocities[i] = Vec2{ dist(rng), dist(rng) };
+			spins[i] = dist(rng);
+		}
+		auto report = [](const char* name, double seconds, double items, float checksum) {
+			std::cout << "  " << name << ": " << seconds / items * 1e9 << " ns/item (" << checksum << ")\n";
+		};
+		std::cout << "[bench] math kernels: " << count << " items x " << repeats << "\n";
+
+		//body i against body i + 1, the same update ArbiterApplyImpulse does for one contact
+		auto start{ BenchClock::now() };
+		for (int r{}; r < repeats; ++r) {
+			for (size_t i{}; i < count; ++i) {
+				KernelContact& c{ contacts[i] };
+				Vec2& v1{ velocities[i] }, & v2{ velocities[i + 1] };
+				float& w1{ spins[i] }, & w2{ spins[i + 1] };
+				Vec2 dv{ v2 + cross(w2, c.r2) - v1 - cross(w1, c.r1) };
+				float dPn{ c.massNormal * -dot(dv, c.normal) };
+				float pn0{ c.accNormal };
+				c.accNormal = std::max(pn0 + dPn, 0.f);
+				Vec2 pn{ c.normal * (c.accNormal - pn0) };
+				v1 -= pn * .5f;
+				w1 -= .5f * cross(c.r1, pn);
+				v2 += pn * .5f;
+				w2 += .5f * cross(c.r2, pn);
+				Vec2 tangent{ cross(c.normal, 1.f) };
+				float dPt{ -c.massTangent * dot(v2 + cross(w2, c.r2) - v1 - cross(w1, c.r1), tangent) };
+				float pt0{ c.accTangent };
+				c.accTangent = std::clamp(pt0 + dPt, -.2f * c.accNormal, .2f * c.accNormal);
+				Vec2 pt{ tangent * (c.accTangent - pt0) };
+				v1 -= pt * .5f;
+				v2 += pt * .5f;
+			}
+		}
+		report("contact impulse", SecondsSince(start), static_cast<double>(count) * repeats, velocities[count / 2].x);
+
+		Mat22 rotation{ cosf(.3f), sinf(.3f), -sinf(.3f), cosf(.3f) };
+		start = BenchClock::now();
+		for (int r{}; r < repeats; ++r) {
+			for (size_t i{}; i < count; ++i) rotated[i] = rotation * points[i] + velocities[i];
+			std::swap(points, rotated);
+		}
+		report("Mat22 * Vec2", SecondsSince(start), static_cast<double>(count) * repeats, points[count / 2].x);
+
+		Mat44 chain;
+		Mat44Identity(chain);
+		//a pure rotation so the chain neither blows up nor decays into denormals
+		Mat44 step{ cosf(.01f), sinf(.01f), 0.f, 0.f, -sinf(.01f), cosf(.01f), 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, .1f, .2f, 0.f, 1.f };
+		start = BenchClock::now();
+		for (int r{}; r < repeats; ++r) {
+			for (size_t i{}; i < count / 16; ++i) chain = chain * step;
+		}
+		report("Mat44 * Mat44", SecondsSince(start), static_cast<double>(count / 16) * repeats, chain.mMat[3].mData[0]);
+
+		std::vector<Vec4> corners(count), transformed(count);
+		for (size_t i{}; i < count; ++i) corners[i] = Vec4{ points[i].x, points[i].y, 0.f, 1.f };
+		start = BenchClock::now();
+		for (int r{}; r < repeats; ++r) {
+			for (size_t i{}; i < count; ++i) transformed[i] = step * corners[i];
+		}
+		report("Mat44 * Vec4 per point", SecondsSince(start), static_cast<double>(count) * repeats, transformed[count / 2].x);
+		start = BenchClock::now();
+		for (int r{}; r < repeats; ++r) Mat44TransformPoints(step, corners.data(), transformed.data(), count);
+		report("Mat44TransformPoints", SecondsSince(start), static_cast<double>(count) * repeats, transformed[count / 2].x);
+
+		//the rotation refresh at the end of a step, a body's angle is rarely far from 0
+		std::vector<float> angles(count), sines(count), cosines(count);
+		for (size_t i{}; i < count; ++i) angles[i] = dist(rng) * 20.f;
+		float maxError{};
+		SinCosBatch(angles.data(), sines.data(), cosines.data(), count);
+		for (size_t i{}; i < count; ++i) {
+			maxError = std::max({ maxError, fabsf(sines[i] - sinf(angles[i])), fabsf(cosines[i] - cosf(angles[i])) });
+		}
+		start = BenchClock::now();
+		for (int r{}; r < repeats; ++r) {
+			for (size_t i{}; i < count; ++i) {
+				sines[i] = sinf(angles[i]);
+				cosines[i] = cosf(angles[i]);
+			}
+		}
+		report("sinf + cosf", SecondsSince(start), static_cast<double>(count) * repeats, sines[count / 2]);
+		start = BenchClock::now();
+		for (int r{}; r < repeats; ++r) SinCosBatch(angles.data(), sines.data(), cosines.data(), count);
+		report("SinCosBatch", SecondsSince(start), static_cast<double>(count) * repeats, sines[count / 2]);
+		std::cout << "  SinCosBatch max error vs sinf/cosf: " << maxError << "\n";
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! RunQuadVertices
+
+	@return true if every check passed.
+
+	Times the cpu side of drawing sprites, writing the 4 vertices of each
+	quad into a buffer, without a gl context. Compares the old way (a
+	translate, rotate and scale mat4 per quad and 4 mat4 * vec4) with
+	Renderer::WriteQuadVertices taking the sin/cos from the rotation each
+	time and from the cache a Transform keeps. Half the quads are
+	unrotated, like most tiles. Prints quads per second and the largest
+	corner difference from the matrix path. Then runs the threaded
+	WriteQuadDrawVertices with 1 to 8 threads and checks each buffer is
+	byte for byte the same as the serial one.
+	*/
+	bool RunQuadVertices() {
+		constexpr size_t count{ RendererData::cMaxQuads };
+		constexpr int repeats{ 100 };
+		std::mt19937 rng{ 7 };
+		std::uniform_real_distribution<float> posDist{ -500.f, 500.f };
+		std::uniform_real_distribution<float> sizeDist{ 1.f, 64.f };
+		std::uniform_real_distribution<float> rotDist{ -180.f, 180.f };
+
+		std::vector<Transform> transforms(count);
+		for (size_t i{}; i < count; ++i) {
+			transforms[i] = Transform{ { posDist(rng), posDist(rng), 0.f }, { 0.f, 0.f, i % 2 ? rotDist(rng) : 0.f },
+				{ sizeDist(rng), sizeDist(rng), 1.f } };
+			transforms[i].GetRotationCosSin();
+		}
+		constexpr glm::vec4 unitQuad[4]{ { -.5f, -.5f, 0.f, 1.f }, { .5f, -.5f, 0.f, 1.f }, { .5f, .5f, 0.f, 1.f }, { -.5f, .5f, 0.f, 1.f } };
+		constexpr glm::vec2 texCoords[4]{ { 0.f, 0.f }, { 1.f, 0.f }, { 1.f, 1.f }, { 0.f, 1.f } };
+		constexpr glm::vec4 clr{ 1.f, 1.f, 1.f, 1.f };
+		std::vector<QuadVtx> reference(count * 4), vertices(count * 4);
+
+		auto report = [](const char* name, double seconds) {
+			std::cout << "  " << name << ": " << static_cast<double>(count) * repeats / seconds / 1e6 << " M quads/s\n";
+		};
+		std::cout << "[bench] quad vertices: " << count << " quads x " << repeats << ", half rotated\n";
+
+		auto start{ BenchClock::now() };
+		for (int r{}; r < repeats; ++r) {
+			QuadVtx* out{ reference.data() };
+			for (auto const& t : transforms) {
+				glm::mat4 mtx{ glm::translate(glm::mat4{ 1.f }, t.position)
+					* glm::rotate(glm::mat4{ 1.f }, glm::radians(t.rotation.z), { 0.f, 0.f, 1.f })
+					* glm::scale(glm::mat4{ 1.f }, { t.scale.x, t.scale.y, 1.f }) };
+				for (size_t k{}; k < 4; ++k, ++out) {
+					*out = QuadVtx{ glm::vec3{ mtx * unitQuad[k] }, clr, texCoords[k], 0.f };
+				}
+			}
+		}
+		report("mat4 per quad", SecondsSince(start));
+
+		start = BenchClock::now();
+		for (int r{}; r < repeats; ++r) {
+			QuadVtx* out{ vertices.data() };
+			for (auto const& t : transforms) {
+				glm::vec2 cosSin{ 1.f, 0.f };
+				if (t.rotation.z != 0.f) SinCos(glm::radians(t.rotation.z), cosSin.y, cosSin.x);
+				out = Renderer::WriteQuadVertices(out, t.position, t.scale, cosSin, clr, texCoords, 0.f);
+			}
+		}
+		report("direct corners, sincos per quad", SecondsSince(start));
+
+		start = BenchClock::now();
+		for (int r{}; r < repeats; ++r) {
+			QuadVtx* out{ vertices.data() };
+			for (auto const& t : transforms) {
+				out = Renderer::WriteQuadVertices(out, t.position, t.scale, t.GetRotationCosSin(), clr, texCoords, 0.f);
+			}
+		}
+		report("direct corners, cached sincos", SecondsSince(start));
+
+		float maxError{};
+		for (size_t i{}; i < vertices.size(); ++i) {
+			maxError = std::max({ maxError, fabsf(vertices[i].pos.x - reference[i].pos.x), fabsf(vertices[i].pos.y - reference[i].pos.y) });
+		}
+		std::cout << "  max corner difference vs mat4: " << maxError << "\n";
+
+		//the threaded path has to give the serial bytes exactly, whatever the thread count
+		std::vector<QuadDraw> draws;
+		for (auto const& t : transforms) draws.push_back(QuadDraw{ &t, nullptr, clr, 0.f });
+		Renderer::WriteQuadDrawVertices(draws.data(), count, reference.data(), 1);
+		bool passed{ true };
+		for (unsigned int threads : { 1u, 2u, 4u, 8u }) {
+			std::fill(vertices.begin(), vertices.end(), QuadVtx{});
+			start = BenchClock::now();
+			for (int r{}; r < repeats; ++r) Renderer::WriteQuadDrawVertices(draws.data(), count, vertices.data(), threads);
+			double seconds{ SecondsSince(start) };
+			bool match{ std::memcmp(vertices.data(), reference.data(), vertices.size() * sizeof(QuadVtx)) == 0 };
+			std::cout << "  WriteQuadDrawVertices " << threads << " thread(s): "
+				<< static_cast<double>(count) * repeats / seconds / 1e6 << " M quads/s, "
+				<< (match ? "MATCH" : "MISMATCH") << " vs serial\n";
+			passed = passed && match;
+		}
+		return passed;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! RunTextureSlots
+
+	@return true if every check passed.
+
+	Runs the renderer on StubGL with 16 texture units, drawing sprites
+	that pick from 12 textures (one batch holds them all) and from 100
+	textures (units run out every few sprites), through DrawSprite and
+	through DrawQuads. Each sprite carries the handle of its texture in
+	its tint, and every draw the stub sees checks that each quad's unit
+	is bound to that handle. Prints ns per sprite, the draw calls and the
+	number of quads on the wrong texture, which should be 0, and the
+	renderer stats of the DrawQuads frame.
+	*/
+	bool RunTextureSlots() {
+		constexpr int texUnits{ 16 };
+		constexpr size_t spriteCount{ 200000 };
+		static size_t checked{}, wrong{};
+
+		StubRenderer stub{ texUnits };
+		StubGL::GetState().onDraw = [](StubGL::State const& gl, unsigned char const* vertices, size_t size, int idxCount) {
+			size_t quads{ static_cast<size_t>(idxCount) / 6 };
+			if (quads * 4 * sizeof(QuadVtx) > size) {
+				wrong += quads;
+				return;
+			}
+			QuadVtx const* vtx{ reinterpret_cast<QuadVtx const*>(vertices) };
+			for (size_t i{}; i < quads; ++i, vtx += 4) {
+				unsigned int unit{ static_cast<unsigned int>(vtx->texIdx) };
+				if (unit >= gl.boundTextures.size() || gl.boundTextures[unit] != static_cast<unsigned int>(vtx->clr.r)) ++wrong;
+				++checked;
+			}
+			//a unit left over from the last batch must not pass the next check
+			StubGL::GetState().boundTextures.clear();
+		};
+
+		bool passed{ true };
+		std::cout << "[bench] texture slots: " << spriteCount << " sprites on stub gl, " << texUnits << " units\n";
+		for (size_t textureCount : { 12u, 100u }) {
+			std::vector<std::shared_ptr<SubTexture>> subtexs;
+			for (size_t i{}; i < textureCount; ++i) {
+				subtexs.push_back(std::make_shared<SubTexture>(std::make_shared<Texture>(1u, 1u), glm::vec2{ 0.f, 0.f }, glm::vec2{ 1.f, 1.f }));
+			}
+			std::mt19937 rng{ 11 };
+			std::uniform_int_distribution<size_t> pick{ 0, textureCount - 1 };
+			std::vector<size_t> picks(spriteCount);
+			for (auto& p : picks) p = pick(rng);
+			auto tintOf = [&subtexs](size_t i) {
+				return glm::vec4{ static_cast<float>(subtexs[i]->GetTexture()->GetTexHdl()), 1.f, 1.f, 1.f };
+			};
+
+			checked = wrong = 0;
+			StubGL::GetState().drawCalls = 0;
+			auto start{ BenchClock::now() };
+			Renderer::RenderSceneBegin(stub.camera);
+			for (size_t p : picks) Renderer::DrawSprite({ 0.f, 0.f, 0.f }, { 1.f, 1.f }, subtexs[p], tintOf(p));
+			Renderer::RenderSceneEnd();
+			double seconds{ SecondsSince(start) };
+			std::cout << "  " << textureCount << " textures, DrawSprite: " << seconds / spriteCount * 1e9 << " ns/sprite, "
+				<< StubGL::GetState().drawCalls << " draw calls, " << checked << " quads checked, " << wrong << " on the wrong texture"
+				<< (wrong ? ", MISMATCH" : "") << "\n";
+			passed = passed && !wrong;
+
+			std::vector<Transform> transforms(spriteCount);
+			std::vector<QuadDraw> draws;
+			for (size_t i{}; i < spriteCount; ++i) draws.push_back(QuadDraw{ &transforms[i], subtexs[picks[i]].get(), tintOf(picks[i]) });
+			checked = wrong = 0;
+			StubGL::GetState().drawCalls = 0;
+			Renderer::ResetStats();
+			start = BenchClock::now();
+			Renderer::RenderSceneBegin(stub.camera);
+			Renderer::DrawQuads(draws);
+			Renderer::RenderSceneEnd();
+			seconds = SecondsSince(start);
+			std::cout << "  " << textureCount << " textures, DrawQuads: " << seconds / spriteCount * 1e9 << " ns/sprite, "
+				<< StubGL::GetState().drawCalls << " draw calls, " << checked << " quads checked, " << wrong << " on the wrong texture"
+				<< (wrong ? ", MISMATCH" : "") << "\n";
+			passed = passed && !wrong;
+			Statistics stats{ Renderer::GetStats() };
+			std::cout << "    renderer stats: " << stats.drawCalls << " draw calls, " << stats.quadCount << " quads, flushes "
+				<< stats.GetFlushCount(FlushReason::INDICES) << " batch full / " << stats.GetFlushCount(FlushReason::TEXTURE_UNITS)
+				<< " texture units / " << stats.GetFlushCount(FlushReason::SCENE_END) << " scene end, "
+				<< stats.uploadBytes / 1024 << " KB uploaded, " << stats.vtxGenMs << " ms vertices, " << stats.submitMs << " ms submit\n";
+		}
+		return passed;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! RunMappedRing
+
+	@return true if every check passed.
+
+	Draws two frames of sprites, enough for five batches each, on StubGL
+	with buffer storage, so the batches are written in place through the
+	persistently mapped rings and wrap around their segments, and again
+	with Renderer::Init(false) so they are copied with SetData. Both go
+	through DrawQuads and then DrawQuadsInstanced. Every draw the stub
+	sees copies the vertices or instances it reads. Checks that both
+	paths drew the same bytes, that every mapped batch was fenced and that
+	every segment but the first few was waited on before it was written
+	again. Prints the time per frame of both paths.
+	*/
+	bool RunMappedRing() {
+		constexpr int texUnits{ 16 };
+		constexpr int frames{ 2 };
+		constexpr size_t spriteCount{ RendererData::cMaxQuads * 4 + 123 };
+		static std::vector<QuadVtx> seen;
+		static std::vector<QuadInstance> seenInstances;
+		static size_t shortDraws{};
+
+		std::mt19937 rng{ 5 };
+		std::uniform_real_distribution<float> pos{ -100.f, 100.f };
+		std::uniform_real_distribution<float> unit{ 0.f, 1.f };
+		std::vector<Transform> transforms(spriteCount);
+		std::vector<QuadDraw> draws;
+		for (auto& t : transforms) {
+			t.position = { pos(rng), pos(rng), 0.f };
+			t.scale = { 1.f + unit(rng), 1.f + unit(rng), 1.f };
+			t.rotation.z = unit(rng) * 360.f;
+			draws.push_back(QuadDraw{ &t, nullptr, glm::vec4{ unit(rng), unit(rng), unit(rng), 1.f } });
+		}
+
+		bool passed{ true };
+		std::vector<QuadVtx> reference;
+		std::vector<QuadInstance> instanceReference;
+		std::cout << "[bench] mapped ring: " << frames << " frames of " << spriteCount << " sprites, "
+			<< RendererData::cVtxSegments << " segments of " << RendererData::cMaxQuads << " quads, stub gl\n";
+		for (bool mapped : { false, true }) {
+			StubRenderer stub{ texUnits, mapped };
+			StubGL::GetState().onDraw = [](StubGL::State const&, unsigned char const* vertices, size_t size, int idxCount) {
+				size_t count{ static_cast<size_t>(idxCount) / 6 * 4 };
+				if (count * sizeof(QuadVtx) > size) {
+					++shortDraws;
+					return;
+				}
+				QuadVtx const* vtx{ reinterpret_cast<QuadVtx const*>(vertices) };
+				seen.insert(seen.end(), vtx, vtx + count);
+			};
+			StubGL::GetState().onInstancedDraw = [](StubGL::State const&, unsigned char const* bytes, size_t size, int baseInstance, int instanceCount) {
+				size_t last{ static_cast<size_t>(baseInstance + instanceCount) };
+				if (last * sizeof(QuadInstance) > size) {
+					++shortDraws;
+					return;
+				}
+				QuadInstance const* instances{ reinterpret_cast<QuadInstance const*>(bytes) };
+				seenInstances.insert(seenInstances.end(), instances + baseInstance, instances + last);
+			};
+			seen.clear();
+			seenInstances.clear();
+			shortDraws = 0;
+
+			auto start{ BenchClock::now() };
+			for (int f{}; f < frames; ++f) {
+				Renderer::RenderSceneBegin(stub.camera);
+				Renderer::DrawQuads(draws);
+				Renderer::RenderSceneEnd();
+			}
+			double seconds{ SecondsSince(start) };
+			StubGL::State const& gl{ StubGL::GetState() };
+			std::cout << "  " << (mapped ? "mapped" : "SetData") << ": " << seconds / frames * 1e6 << " us/frame, "
+				<< gl.drawCalls << " draw calls, " << gl.fencesCreated << " fences, " << gl.fenceWaits << " waits";
+
+			bool match{ !shortDraws && seen.size() == spriteCount * frames * 4 };
+			if (!mapped) {
+				reference = seen;
+				if (!match) std::cout << ", MISMATCH";
+			}
+			else {
+				match = match && seen.size() == reference.size()
+					&& std::memcmp(seen.data(), reference.data(), seen.size() * sizeof(QuadVtx)) == 0;
+				//the first write to each segment has nothing to wait on
+				match = match && gl.fencesCreated == gl.drawCalls && gl.fencesCreated >= RendererData::cVtxSegments
+					&& gl.fenceWaits == gl.fencesCreated - RendererData::cVtxSegments;
+				std::cout << ", vertices and fences " << (match ? "MATCH" : "MISMATCH") << " vs SetData";
+			}
+			std::cout << "\n";
+			passed = passed && match;
+
+			//the same sprites as instances, a chunk of the queue per segment, on fresh rings
+			//so the fences of the quad ring are not waited on
+			Renderer::Init(mapped);
+			StubGL::GetState().drawCalls = StubGL::GetState().fencesCreated = StubGL::GetState().fenceWaits = 0;
+			start = BenchClock::now();
+			for (int f{}; f < frames; ++f) {
+				Renderer::RenderSceneBegin(stub.camera);
+				Renderer::DrawQuadsInstanced(draws);
+				Renderer::RenderSceneEnd();
+			}
+			seconds = SecondsSince(start);
+			std::cout << "  " << (mapped ? "mapped" : "SetData") << " instanced: " << seconds / frames * 1e6 << " us/frame, "
+				<< gl.drawCalls << " draw calls, " << gl.fencesCreated << " fences, " << gl.fenceWaits << " waits";
+
+			match = !shortDraws && seenInstances.size() == spriteCount * frames;
+			if (!mapped) {
+				instanceReference = seenInstances;
+				if (!match) std::cout << ", MISMATCH";
+			}
+			else {
+				match = match && seenInstances.size() == instanceReference.size()
+					&& std::memcmp(seenInstances.data(), instanceReference.data(), seenInstances.size() * sizeof(QuadInstance)) == 0;
+				match = match && gl.fencesCreated == gl.drawCalls && gl.fencesCreated >= RendererData::cVtxSegments
+					&& gl.fenceWaits == gl.fencesCreated - RendererData::cVtxSegments;
+				std::cout << ", instances and fences " << (match ? "MATCH" : "MISMATCH") << " vs SetData";
+			}
+			std::cout << "\n";
+			passed = passed && match;
+		}
+		seen = std::vector<QuadVtx>{};
+		seenInstances = std::vector<QuadInstance>{};
+		return passed;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! RunRenderQueue
+
+	@return true if every check passed.
+
+	Orders a 2500 sprite queue the old way (std::sort comparing layer then
+	z through the component pointers) and with RenderSystem::MakeSortKey
+	and RadixSort, then draws both orders on StubGL with 16 units. The
+	first scene is the editor stress scene, a 50x50 grid at random depth
+	animating over 3 sheets. The second is the same grid flat at z 0 over
+	48 textures, where texture order decides the batches. Prints the sort
+	time, draw calls, texture switches along the queue and whether the key
+	order keeps the old layer and depth order.
+	*/
+	bool RunRenderQueue() {
+		constexpr int texUnits{ 16 };
+		constexpr int side{ 50 };
+		constexpr int repeats{ 200 };
+		struct Entry {
+			Transform* transform;
+			Sprite* sprite;
+		};
+		auto oldLess = [](Entry const& lhs, Entry const& rhs) {
+			if (lhs.sprite->layer != rhs.sprite->layer) {
+				return static_cast<int>(lhs.sprite->layer) < static_cast<int>(rhs.sprite->layer);
+			}
+			return lhs.transform->position.z < rhs.transform->position.z;
+		};
+
+		StubRenderer stub{ texUnits };
+		bool passed{ true };
+		std::cout << "[bench] render queue: " << side * side << " sprites x " << repeats << " sorts, stub gl with " << texUnits << " units\n";
+
+		for (bool isFlat : { false, true }) {
+			size_t textureCount{ isFlat ? 48u : 3u };
+			std::vector<std::shared_ptr<Texture>> textures;
+			for (size_t i{}; i < textureCount; ++i) textures.push_back(std::make_shared<Texture>(1u, 1u));
+			//the stress scene animates over 23 frames, 8 idle, 8 run and 7 attack, one sheet each
+			std::vector<std::shared_ptr<SubTexture>> frames;
+			for (size_t i{}; i < (isFlat ? textureCount : 23u); ++i) {
+				size_t sheet{ isFlat ? i : (i < 8 ? 0u : i < 16 ? 1u : 2u) };
+				frames.push_back(std::make_shared<SubTexture>(textures[sheet], glm::vec2{ 0.f, 0.f }, glm::vec2{ 1.f, 1.f }));
+			}
+
+			std::mt19937 rng{ 5 };
+			std::uniform_real_distribution<float> depthDist{ -1.f, 0.f };
+			std::uniform_int_distribution<size_t> frameDist{ 0, frames.size() - 1 };
+			std::vector<Transform> transforms;
+			std::vector<Sprite> sprites;
+			for (int i{}; i < side; ++i) {
+				for (int j{}; j < side; ++j) {
+					transforms.push_back(Transform{ { i * 5.f - 125.f, j * 5.f - 125.f, isFlat ? 0.f : depthDist(rng) }, { 0.f, 0.f, 0.f }, { 10.f, 10.f, 10.f } });
+					sprites.push_back(Sprite{ { 1.f, 1.f, 1.f, 1.f }, frames[frameDist(rng)], Layer::FOREGROUND });
+				}
+			}
+			std::vector<Entry> queue;
+			for (size_t i{}; i < sprites.size(); ++i) queue.push_back(Entry{ &transforms[i], &sprites[i] });
+
+			std::vector<Entry> sorted;
+			auto start{ BenchClock::now() };
+			for (int r{}; r < repeats; ++r) {
+				sorted = queue;
+				std::sort(sorted.begin(), sorted.end(), oldLess);
+			}
+			double sortSeconds{ SecondsSince(start) };
+
+			std::vector<Image::KeyIndex> keys, scratch;
+			start = BenchClock::now();
+			for (int r{}; r < repeats; ++r) {
+				keys.clear();
+				for (size_t i{}; i < queue.size(); ++i) {
+					keys.push_back(Image::KeyIndex{ RenderSystem::MakeSortKey(*queue[i].transform, *queue[i].sprite), static_cast<uint32_t>(i) });
+				}
+				Image::RadixSort(keys, scratch);
+			}
+			double radixSeconds{ SecondsSince(start) };
+			std::vector<Entry> keyed;
+			for (auto const& key : keys) keyed.push_back(queue[key.index]);
+			bool isOrdered{ true };
+			for (size_t i{ 1 }; i < keyed.size(); ++i) {
+				if (oldLess(keyed[i], keyed[i - 1])) isOrdered = false;
+			}
+
+			std::cout << "  " << (isFlat ? "flat grid at z 0, 48 textures" : "stress scene, random z, 3 sheets") << "\n";
+			auto drawOrder = [&stub](std::vector<Entry> const& order, const char* name, double seconds) {
+				std::vector<QuadDraw> draws;
+				size_t switches{};
+				for (size_t i{}; i < order.size(); ++i) {
+					draws.push_back(QuadDraw{ order[i].transform, order[i].sprite->texture.get(), order[i].sprite->color });
+					if (i && order[i].sprite->texture->GetTexture() != order[i - 1].sprite->texture->GetTexture()) ++switches;
+				}
+				StubGL::GetState().drawCalls = 0;
+				Renderer::RenderSceneBegin(stub.camera);
+				Renderer::DrawQuads(draws);
+				Renderer::RenderSceneEnd();
+				std::cout << "    " << name << ": " << seconds / repeats * 1e6 << " us/sort, " << StubGL::GetState().drawCalls
+					<< " draw calls, " << switches << " texture switches\n";
+			};
+			drawOrder(sorted, "std::sort layer, z", sortSeconds);
+			drawOrder(keyed, "radix sort key", radixSeconds);
+			std::cout << "    key order keeps layer then z: " << (isOrdered ? "yes" : "no, MISMATCH") << "\n";
+			passed = passed && isOrdered;
+		}
+		return passed;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! RunSpriteCulling
+
+	@return true if every check passed.
+
+	Culls 20000 sprites spread over a 2000 unit square, plus the 350 unit
+	wide background, against the game camera as it starts, zoomed in, and
+	moved and turned. Times building the sprite boxes and culling them,
+	checks every sprite against the box around its 4 corners from the
+	transform matrix, and prints the visible and culled counts from the
+	renderer stats. Then times drawing every sprite against drawing only
+	the visible ones on StubGL.
+	*/
+	bool RunSpriteCulling() {
+		constexpr size_t spriteCount{ 20000 };
+		constexpr int repeats{ 100 };
+		std::mt19937 rng{ 13 };
+		std::uniform_real_distribution<float> posDist{ -1000.f, 1000.f };
+		std::uniform_real_distribution<float> sizeDist{ 2.f, 40.f };
+		std::uniform_real_distribution<float> rotDist{ -180.f, 180.f };
+		std::vector<Transform> transforms;
+		transforms.push_back(Transform{ { 0.f, 0.f, -40.f }, { 0.f, 0.f, 0.f }, { 350.f, 120.f, 0.f } });
+		for (size_t i{ 1 }; i < spriteCount; ++i) {
+			transforms.push_back(Transform{ { posDist(rng), posDist(rng), 0.f }, { 0.f, 0.f, i % 2 ? rotDist(rng) : 0.f },
+				{ sizeDist(rng), sizeDist(rng), 1.f } });
+		}
+
+		StubRenderer stub{ 16 };
+		float aspectRatio{ static_cast<float>(ENGINE_SCREEN_WIDTH) / static_cast<float>(ENGINE_SCREEN_HEIGHT) };
+		float limitX{ static_cast<float>(WORLD_LIMIT_X) }, limitY{ static_cast<float>(WORLD_LIMIT_Y) };
+		bool passed{ true };
+		std::cout << "[bench] sprite culling: " << spriteCount << " sprites over 2000x2000\n";
+
+		Collision::AABBSoA bounds;
+		std::vector<uint32_t> visibleMask;
+		for (int view{}; view < 3; ++view) {
+			OrthoCamera camera{ aspectRatio, -limitX * aspectRatio, limitX * aspectRatio, -limitY, limitY };
+			if (view == 1) camera.SetProjectionMtx(-limitX * aspectRatio / 4.f, limitX * aspectRatio / 4.f, -limitY / 4.f, limitY / 4.f);
+			if (view == 2) {
+				camera.SetPosition({ 400.f, -250.f, 0.f });
+				camera.SetRotation(30.f);
+			}
+
+			auto start{ BenchClock::now() };
+			for (int r{}; r < repeats; ++r) {
+				bounds.Clear();
+				for (auto const& t : transforms) RenderSystem::PushSpriteBounds(t, bounds);
+				RenderSystem::CullSprites(camera, bounds, visibleMask);
+			}
+			double seconds{ SecondsSince(start) };
+
+			Renderer::ResetStats();
+			RenderSystem::CullSprites(camera, bounds, visibleMask);
+			Statistics stats{ Renderer::GetStats() };
+
+			//reference, the box around the corners the matrix path would draw
+			glm::vec2 viewMin, viewMax;
+			camera.GetViewBounds(viewMin, viewMax);
+			constexpr glm::vec4 unitQuad[4]{ { -.5f, -.5f, 0.f, 1.f }, { .5f, -.5f, 0.f, 1.f }, { .5f, .5f, 0.f, 1.f }, { -.5f, .5f, 0.f, 1.f } };
+			size_t mismatches{};
+			std::vector<QuadDraw> all, visible;
+			for (size_t i{}; i < transforms.size(); ++i) {
+				glm::vec2 min{ FLOAT_MAX }, max{ -FLOAT_MAX };
+				for (auto const& corner : unitQuad) {
+					glm::vec2 p{ transforms[i].GetMatrix() * corner };
+					min = glm::min(min, p);
+					max = glm::max(max, p);
+				}
+				bool inView{ viewMin.x < max.x && viewMax.x > min.x && viewMin.y < max.y && viewMax.y > min.y };
+				bool isVisible{ ((visibleMask[i >> 5] >> (i & 31)) & 1u) != 0u };
+				if (inView != isVisible) ++mismatches;
+				all.push_back(QuadDraw{ &transforms[i], nullptr, { 1.f, 1.f, 1.f, 1.f } });
+				if (isVisible) visible.push_back(all.back());
+			}
+
+			auto drawSeconds = [&camera](std::vector<QuadDraw>& draws) {
+				auto drawStart{ BenchClock::now() };
+				for (int r{}; r < repeats; ++r) {
+					Renderer::RenderSceneBegin(camera);
+					Renderer::DrawQuads(draws);
+					Renderer::RenderSceneEnd();
+				}
+				return SecondsSince(drawStart) / repeats * 1e6;
+			};
+			const char* names[]{ "game camera", "zoomed in 4x", "moved and turned 30 deg" };
+			std::cout << "  " << names[view] << ": " << stats.visibleCount << " visible, " << stats.culledCount << " culled, "
+				<< seconds / repeats * 1e6 << " us for bounds + cull, " << mismatches << " mismatches vs corners"
+				<< (mismatches ? ", MISMATCH" : "") << "\n";
+			std::cout << "    drawing all: " << drawSeconds(all) << " us, drawing visible: " << drawSeconds(visible) << " us\n";
+			passed = passed && !mismatches;
+		}
+		return passed;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! RunInstancing
+
+	@return true if every check passed.
+
+	Draws the editor stress scene, a 50x50 grid at random depth with every
+	other sprite turned, animating over 23 frames of 3 sheets, through
+	DrawQuads and DrawQuadsInstanced on StubGL with 16 units, then the same
+	grid over 40 textures so the instances are split into runs. Checks that
+	every instance expanded the way Instanced.vert does gives the vertices
+	of WriteQuadDrawVertices, and that every instanced draw the stub sees
+	has each instance's unit bound to its texture, and that a line batched
+	before instanced or static sprites is still drawn. Prints the bytes
+	uploaded per frame, the draw calls and the time of both paths.
+	*/
+	bool RunInstancing() {
+		constexpr int texUnits{ 16 };
+		constexpr int side{ 50 };
+		constexpr int repeats{ 200 };
+		static std::vector<QuadDraw> const* drawn{};
+		static size_t checked{}, wrong{};
+
+		StubRenderer stub{ texUnits };
+		StubGL::GetState().onInstancedDraw = [](StubGL::State const& gl, unsigned char const* bytes, size_t size, int baseInstance, int instanceCount) {
+			size_t last{ static_cast<size_t>(baseInstance + instanceCount) };
+			//the queue is one chunk, written at the start of a segment of the ring
+			size_t segmentStart{ static_cast<size_t>(baseInstance) / RendererData::cMaxQuads * RendererData::cMaxQuads };
+			if (last * sizeof(QuadInstance) > size || last - segmentStart > drawn->size()) {
+				wrong += static_cast<size_t>(instanceCount);
+				return;
+			}
+			QuadInstance const* instances{ reinterpret_cast<QuadInstance const*>(bytes) };
+			for (size_t i{ static_cast<size_t>(baseInstance) }; i < last; ++i) {
+				unsigned int unit{ static_cast<unsigned int>(instances[i].texIdx) };
+				unsigned int hdl{ (*drawn)[i - segmentStart].subtex->GetTexture()->GetTexHdl() };
+				if (unit >= gl.boundTextures.size() || gl.boundTextures[unit] != hdl) ++wrong;
+				++checked;
+			}
+			StubGL::GetState().boundTextures.clear();
+		};
+
+		bool passed{ true };
+		std::cout << "[bench] instancing: " << side * side << " sprites x " << repeats << " frames, stub gl with " << texUnits
+			<< " units, " << sizeof(QuadVtx) * 4 << " B/sprite as vertices, " << sizeof(QuadInstance) << " B/sprite as an instance\n";
+
+		for (size_t textureCount : { 3u, 40u }) {
+			std::vector<std::shared_ptr<Texture>> textures;
+			for (size_t i{}; i < textureCount; ++i) textures.push_back(std::make_shared<Texture>(1u, 1u));
+			//23 frames, 8 idle, 8 run and 7 attack, each a cell of its sheet
+			std::vector<std::shared_ptr<SubTexture>> frames;
+			for (size_t i{}; i < std::max<size_t>(textureCount, 23u); ++i) {
+				size_t sheet{ textureCount == 3u ? (i < 8 ? 0u : i < 16 ? 1u : 2u) : i };
+				glm::vec2 min{ static_cast<float>(i % 8) / 8.f, 0.f };
+				frames.push_back(std::make_shared<SubTexture>(textures[sheet], min, min + glm::vec2{ 1.f / 8.f, 1.f }));
+			}
+
+			std::mt19937 rng{ 5 };
+			std::uniform_real_distribution<float> depthDist{ -1.f, 0.f };
+			std::uniform_real_distribution<float> rotDist{ -180.f, 180.f };
+			std::uniform_int_distribution<size_t> frameDist{ 0, frames.size() - 1 };
+			std::uniform_int_distribution<int> channelDist{ 0, 255 };
+			std::vector<Transform> transforms;
+			std::vector<QuadDraw> draws;
+			transforms.reserve(side * side);
+			for (int i{}; i < side * side; ++i) {
+				transforms.push_back(Transform{ { (i / side) * 5.f - 125.f, (i % side) * 5.f - 125.f, depthDist(rng) },
+					{ 0.f, 0.f, i % 2 ? rotDist(rng) : 0.f }, { 10.f, 10.f, 10.f } });
+			}
+			for (auto const& t : transforms) {
+				glm::vec4 clr{ channelDist(rng) / 255.f, channelDist(rng) / 255.f, channelDist(rng) / 255.f, 1.f };
+				draws.push_back(QuadDraw{ &t, frames[frameDist(rng)].get(), clr, 0.f });
+			}
+			drawn = &draws;
+
+			//every instance expanded like Instanced.vert against the cpu vertices
+			std::vector<QuadVtx> vertices(draws.size() * 4);
+			std::vector<QuadInstance> instances(draws.size());
+			Renderer::WriteQuadDrawVertices(draws.data(), draws.size(), vertices.data(), 1);
+			Renderer::WriteQuadInstances(draws.data(), draws.size(), instances.data(), 1);
+			constexpr glm::vec2 corners[4]{ { -1.f, -1.f }, { 1.f, -1.f }, { 1.f, 1.f }, { -1.f, 1.f } };
+			float maxPosError{}, maxClrError{};
+			size_t texMismatches{};
+			for (size_t i{}; i < instances.size(); ++i) {
+				QuadInstance const& instance{ instances[i] };
+				glm::vec2 half{ instance.scale * .5f };
+				glm::vec2 axisX{ instance.cosSin.x * half.x, instance.cosSin.y * half.x };
+				glm::vec2 axisY{ -instance.cosSin.y * half.y, instance.cosSin.x * half.y };
+				glm::vec4 clr{ glm::unpackUnorm4x8(instance.clr) };
+				for (size_t c{}; c < 4; ++c) {
+					QuadVtx const& vtx{ vertices[i * 4 + c] };
+					glm::vec2 pos{ glm::vec2{ instance.pos } + corners[c].x * axisX + corners[c].y * axisY };
+					glm::vec2 uv{ corners[c].x < 0.f ? instance.texRect.x : instance.texRect.z,
+						corners[c].y < 0.f ? instance.texRect.y : instance.texRect.w };
+					maxPosError = std::max({ maxPosError, std::abs(pos.x - vtx.pos.x), std::abs(pos.y - vtx.pos.y), std::abs(instance.pos.z - vtx.pos.z) });
+					maxClrError = std::max(maxClrError, glm::length(clr - vtx.clr));
+					if (uv != vtx.texCoord || instance.texIdx != vtx.texIdx) ++texMismatches;
+				}
+			}
+
+			auto drawFrames = [&stub, &draws](bool isInstanced) {
+				Renderer::ResetStats();
+				auto start{ BenchClock::now() };
+				for (int r{}; r < repeats; ++r) {
+					Renderer::RenderSceneBegin(stub.camera);
+					if (isInstanced) Renderer::DrawQuadsInstanced(draws);
+					else Renderer::DrawQuads(draws);
+					Renderer::RenderSceneEnd();
+				}
+				double seconds{ SecondsSince(start) };
+				Statistics stats{ Renderer::GetStats() };
+				std::cout << "    " << (isInstanced ? "DrawQuadsInstanced" : "DrawQuads") << ": " << stats.uploadBytes / repeats
+					<< " B/frame uploaded, " << stats.drawCalls / repeats << " draw calls, " << seconds / repeats * 1e6 << " us/frame, "
+					<< stats.vtxGenMs / repeats * 1e3 << " us writing, " << stats.submitMs / repeats * 1e3 << " us submit\n";
+			};
+			std::cout << "  " << (textureCount == 3u ? "stress scene, 3 sheets" : "same grid, 40 textures") << "\n";
+			checked = wrong = 0;
+			drawFrames(false);
+			drawFrames(true);
+			std::cout << "    instances vs vertices: max position error " << maxPosError << ", max color error " << maxClrError
+				<< ", " << texMismatches << " texture coord/unit mismatches, " << checked << " instances checked, "
+				<< wrong << " on the wrong texture" << (texMismatches || wrong ? ", MISMATCH" : "") << "\n";
+			passed = passed && !texMismatches && !wrong;
+		}
+
+		//a line batched before instanced or static sprites is still drawn with the scene
+		std::vector<Transform> quadTransforms(3);
+		std::vector<QuadDraw> quads;
+		for (auto const& t : quadTransforms) quads.push_back(QuadDraw{ &t, nullptr, glm::vec4{ 1.f } });
+		StaticBatch batch;
+		int linesKept{};
+		StubGL::GetState().onInstancedDraw = nullptr; //its queue is gone
+		for (int step{}; step < 3; ++step) {
+			StubGL::GetState().lineDrawCalls = 0;
+			Renderer::RenderSceneBegin(stub.camera);
+			Renderer::DrawLine({ 0.f, 0.f, 0.f }, { 1.f, 1.f, 0.f }, glm::vec4{ 1.f });
+			if (step == 0) Renderer::DrawQuadsInstanced(quads);
+			else if (step == 1) Renderer::BuildStaticBatch(quads, batch);
+			else Renderer::DrawStaticBatch(batch);
+			Renderer::RenderSceneEnd();
+			if (StubGL::GetState().lineDrawCalls == 1) ++linesKept;
+		}
+		std::cout << "  lines batched before DrawQuadsInstanced, BuildStaticBatch and DrawStaticBatch: " << linesKept
+			<< " of 3 drawn" << (linesKept == 3 ? "" : ", MISMATCH") << "\n";
+		passed = passed && linesKept == 3;
+		return passed;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! RunStaticBatches
+
+	@return true if every check passed.
+
+	Runs RenderSystem::Update on StubGL over a level of 5000 decorative
+	tiles on 3 textures in the background and midground, with 200 sprites
+	moving in front of them. The tiles are first drawn as plain sprites,
+	then flagged static. Prints the time per frame, the bytes uploaded and
+	the draw calls of both, and how many static batches were built over
+	the frames. Then moves one tile, recolors one and destroys one. Each
+	should rebuild the batches exactly once, and every sprite should still
+	be drawn. Last moves and clones a moving sprite, neither should rebuild
+	and the clone should be drawn.
+	*/
+	bool RunStaticBatches() {
+		constexpr int tileSide{ 100 };
+		constexpr int tileRows{ 50 };
+		constexpr size_t movingCount{ 200 };
+		constexpr int frames{ 200 };
+
+		SetupPhysicsWorld();
+		std::shared_ptr<Coordinator> coordinator{ Coordinator::GetInstance() };
+		static std::shared_ptr<RenderSystem> renderSystem;
+		if (!renderSystem) {
+			StubGL::Install(16);
+			coordinator->RegisterComponent<Sprite>();
+			coordinator->RegisterComponent<Camera>();
+			coordinator->RegisterComponent<OrthoCamera>();
+			renderSystem = coordinator->RegisterSystem<RenderSystem>();
+			Signature signature;
+			signature.set(coordinator->GetComponentType<Sprite>());
+			signature.set(coordinator->GetComponentType<Transform>());
+			coordinator->SetSystemSignature<RenderSystem>(signature);
+			TextureAtlas::GetInstance()->Init("assets");
+			renderSystem->Init();
+		}
+
+		std::vector<std::shared_ptr<SubTexture>> tiles;
+		for (int i{}; i < 3; ++i) {
+			tiles.push_back(std::make_shared<SubTexture>(std::make_shared<Texture>(1u, 1u), glm::vec2{ 0.f, 0.f }, glm::vec2{ 1.f, 1.f }));
+		}
+		std::vector<Entity> tileEntities, movingEntities;
+		for (int i{}; i < tileSide * tileRows; ++i) {
+			Entity e{ coordinator->CreateEntity() };
+			coordinator->AddComponent(e, Transform{ { (i % tileSide) * 4.f - 200.f, (i / tileSide) * 4.f - 100.f, -20.f + (i % 7) },
+				{ 0.f, 0.f, 0.f }, { 4.f, 4.f, 1.f } });
+			coordinator->AddComponent(e, Sprite{ { 1.f, 1.f, 1.f, 1.f }, tiles[i % 3], i % 2 ? Layer::MIDGROUND : Layer::BACKGROUND });
+			tileEntities.push_back(e);
+		}
+		for (size_t i{}; i < movingCount; ++i) {
+			Entity e{ coordinator->CreateEntity() };
+			coordinator->AddComponent(e, Transform{ { i * 2.f - 200.f, 0.f, 0.f }, { 0.f, 0.f, 0.f }, { 5.f, 5.f, 1.f } });
+			coordinator->AddComponent(e, Sprite{ { 1.f, 0.f, 0.f, 1.f }, nullptr, Layer::FOREGROUND });
+			movingEntities.push_back(e);
+		}
+		size_t spriteCount{ renderSystem->mEntities.size() };
+
+		struct FrameTotals {
+			double us{};
+			size_t uploadBytes{};
+			unsigned int drawCalls{}, quadCount{}, staticQuads{}, builds{}, buildFrames{};
+		};
+		auto runFrames = [&](int count) {
+			FrameTotals totals;
+			for (int f{}; f < count; ++f) {
+				for (size_t i{}; i < movingEntities.size(); ++i) {
+					coordinator->GetComponent<Transform>(movingEntities[i]).position.y = static_cast<float>((f + i) % 100) - 50.f;
+				}
+				auto start{ BenchClock::now() };
+				renderSystem->Update(0.f);
+				totals.us += SecondsSince(start) * 1e6;
+				Statistics stats{ Renderer::GetStats() };
+				totals.uploadBytes += stats.uploadBytes;
+				totals.drawCalls += stats.drawCalls;
+				totals.quadCount = stats.quadCount + stats.culledCount;
+				totals.staticQuads = stats.staticQuadCount;
+				totals.builds += stats.staticBuilds;
+				if (stats.staticBuilds) ++totals.buildFrames;
+			}
+			return totals;
+		};
+
+		bool passed{ true };
+		std::cout << "[bench] static batches: " << tileSide * tileRows << " tiles and " << movingCount << " moving sprites, "
+			<< spriteCount << " sprites with the background, " << frames << " frames on stub gl\n";
+		runFrames(1);
+		for (bool isStatic : { false, true }) {
+			for (Entity e : tileEntities) coordinator->GetComponent<Sprite>(e).isStatic = isStatic;
+			runFrames(2); //the flag is seen on the first frame, baked on the next
+			FrameTotals totals{ runFrames(frames) };
+			bool isExpected{ totals.buildFrames == 0 && totals.quadCount == spriteCount };
+			std::cout << "  tiles " << (isStatic ? "static" : "drawn every frame") << ": " << totals.us / frames << " us/frame, "
+				<< totals.uploadBytes / frames << " B/frame uploaded, " << totals.drawCalls / frames << " draw calls, "
+				<< totals.staticQuads << " quads from static batches, " << totals.buildFrames << " rebuilds, "
+				<< totals.quadCount << " of " << spriteCount << " sprites drawn or culled" << (isExpected ? "" : ", MISMATCH") << "\n";
+			passed = passed && isExpected;
+		}
+
+		auto checkChange = [&](const char* name, unsigned int rebuilds, auto change) {
+			change();
+			FrameTotals totals{ runFrames(3) };
+			//built once, one batch per layer with static sprites, then left alone
+			bool isExpected{ totals.buildFrames == rebuilds && totals.quadCount == renderSystem->mEntities.size() };
+			std::cout << "  " << name << ": " << totals.buildFrames << " rebuilds (" << totals.builds << " batches) over 3 frames, "
+				<< totals.quadCount << " of " << renderSystem->mEntities.size() << " sprites drawn or culled"
+				<< (isExpected ? "" : ", MISMATCH") << "\n";
+			passed = passed && isExpected;
+		};
+		checkChange("moved a tile", 1, [&] { coordinator->GetComponent<Transform>(tileEntities[10]).position.x += 1.f; });
+		checkChange("recolored a tile", 1, [&] { coordinator->GetComponent<Sprite>(tileEntities[20]).color.g = .5f; });
+		checkChange("destroyed a tile", 1, [&] { coordinator->DestroyEntity(tileEntities[30]); tileEntities.erase(tileEntities.begin() + 30); });
+		checkChange("moved a sprite", 0, [&] { coordinator->GetComponent<Transform>(movingEntities[0]).position.x += 1.f; });
+		checkChange("cloned a sprite", 0, [&] { movingEntities.push_back(coordinator->CloneEntity(movingEntities[0])); });
+		//the entity count is the same as before, only the events tell
+		checkChange("destroyed and cloned a sprite in one frame", 0, [&] {
+			coordinator->DestroyEntity(movingEntities.back());
+			movingEntities.back() = coordinator->CloneEntity(movingEntities[0]);
+		});
+		//never culled in, the flag has to be seen anyway
+		checkChange("added a sprite off screen", 0, [&] {
+			Entity e{ coordinator->CreateEntity() };
+			coordinator->AddComponent(e, Transform{ { 10000.f, 10000.f, 0.f }, { 0.f, 0.f, 0.f }, { 4.f, 4.f, 1.f } });
+			coordinator->AddComponent(e, Sprite{ { 1.f, 1.f, 1.f, 1.f }, tiles[0], Layer::BACKGROUND });
+			tileEntities.push_back(e);
+		});
+		checkChange("flagged it static off screen", 1, [&] { coordinator->GetComponent<Sprite>(tileEntities.back()).isStatic = true; });
+
+		for (Entity e : tileEntities) coordinator->DestroyEntity(e);
+		for (Entity e : movingEntities) coordinator->DestroyEntity(e);
+		movingEntities.clear();
+		runFrames(1);
+		return passed;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! RunTextureAtlas
+
+	@return true if every check passed.
+
+	Builds the atlas from data/assets.json on StubGL and prints the pages,
+	how much of them the sprites fill and the build time. Checks every
+	sprite against its cell of the sheet pixel by pixel through the uvs of
+	the table, that its padding repeats its edge pixels and that no two
+	padded sprites overlap. Then draws 2500 sprites cycling through the
+	animation frames and the background in random depth order, once with
+	one texture per sheet and once from the atlas, at 16 and 4 texture
+	units, and prints the draw calls of each.
+	*/
+	bool RunTextureAtlas() {
+		constexpr unsigned int pad{ TextureAtlas::cPadding };
+		constexpr int spriteCount{ 2500 };
+
+		std::cout << "[bench] texture atlas: sheets from data/assets.json packed on stub gl\n";
+		StubGL::Install(16);
+		auto start{ BenchClock::now() };
+		TextureAtlas::GetInstance()->Init("assets");
+		double seconds{ SecondsSince(start) };
+
+		std::shared_ptr<TextureAtlas> atlas{ TextureAtlas::GetInstance() };
+		size_t spritePixels{}, pagePixels{}, regionCount{};
+		for (auto const& sheet : atlas->GetRegions()) {
+			for (auto const& region : sheet.second) {
+				glm::vec2 size{ (region.max - region.min) * glm::vec2{ region.texture->GetWidth(), region.texture->GetHeight() } };
+				spritePixels += static_cast<size_t>(std::lround(size.x)) * static_cast<size_t>(std::lround(size.y));
+				++regionCount;
+			}
+		}
+		std::cout << "  " << regionCount << " sprites on " << atlas->GetPages().size() << " pages (";
+		for (auto const& page : atlas->GetPages()) {
+			std::cout << (page == atlas->GetPages().front() ? "" : ", ") << page->GetWidth() << "x" << page->GetHeight();
+			pagePixels += static_cast<size_t>(page->GetWidth()) * page->GetHeight();
+		}
+		std::cout << "), " << 100.0 * spritePixels / pagePixels << "% filled, built in " << seconds * 1e3 << " ms\n";
+
+		//every sprite read back through its uvs against its cell of the sheet
+		struct PixelRect {
+			Texture const* page;
+			long x, y, w, h;
+		};
+		std::vector<PixelRect> rects;
+		size_t pixelMismatches{}, paddingMismatches{};
+		for (auto const& sheet : atlas->GetRegions()) {
+			int width, height, channels;
+			stbi_set_flip_vertically_on_load(true);
+			unsigned char* source{ stbi_load(sheet.first.c_str(), &width, &height, &channels, STBI_rgb_alpha) };
+			stbi_set_flip_vertically_on_load(false);
+			if (!source) {
+				std::cout << "  could not load " << sheet.first << ", MISMATCH\n";
+				++pixelMismatches;
+				continue;
+			}
+			for (auto const& region : sheet.second) {
+				Texture const& page{ *region.texture };
+				glm::vec2 pageSize{ page.GetWidth(), page.GetHeight() };
+				PixelRect rect{ &page, std::lround(region.min.x * pageSize.x), std::lround(region.min.y * pageSize.y), 0, 0 };
+				rect.w = std::lround(region.max.x * pageSize.x) - rect.x;
+				rect.h = std::lround(region.max.y * pageSize.y) - rect.y;
+				rects.push_back(rect);
+				//the table keeps the sprites in id order, and every sheet lists its cells left to right
+				long cellX{ static_cast<long>(&region - sheet.second.data()) * rect.w };
+				std::vector<unsigned char> const& pixels{ StubGL::GetState().textureData[page.GetTexHdl()] };
+				for (long y{ -static_cast<long>(pad) }; y < rect.h + static_cast<long>(pad); ++y) {
+					for (long x{ -static_cast<long>(pad) }; x < rect.w + static_cast<long>(pad); ++x) {
+						long srcX{ cellX + std::clamp(x, 0l, rect.w - 1) }, srcY{ std::clamp(y, 0l, rect.h - 1) };
+						size_t atlasIdx{ (static_cast<size_t>(rect.y + y) * page.GetWidth() + static_cast<size_t>(rect.x + x)) * 4 };
+						bool isPadding{ x < 0 || y < 0 || x >= rect.w || y >= rect.h };
+						if (atlasIdx + 4 > pixels.size() || std::memcmp(&pixels[atlasIdx], source + (static_cast<size_t>(srcY) * width + srcX) * 4, 4)) {
+							++(isPadding ? paddingMismatches : pixelMismatches);
+						}
+					}
+				}
+			}
+			stbi_image_free(source);
+		}
+		size_t overlaps{};
+		for (size_t i{}; i < rects.size(); ++i) {
+			for (size_t j{ i + 1 }; j < rects.size(); ++j) {
+				PixelRect const& a{ rects[i] }, & b{ rects[j] };
+				long p{ static_cast<long>(pad) * 2 };
+				if (a.page == b.page && a.x < b.x + b.w + p && b.x < a.x + a.w + p && a.y < b.y + b.h + p && b.y < a.y + a.h + p) ++overlaps;
+			}
+		}
+		bool passed{ !pixelMismatches && !paddingMismatches && !overlaps };
+		std::cout << "  " << pixelMismatches << " sprite pixels and " << paddingMismatches << " padding pixels differ from the sheets, "
+			<< overlaps << " padded sprites overlap" << (passed ? "" : ", MISMATCH") << "\n";
+
+		//the animation frames and the background, one texture per sheet as before against the atlas
+		std::vector<std::pair<std::string, unsigned int>> cells;
+		for (auto const& sheet : atlas->GetRegions()) {
+			for (unsigned int id{}; id < sheet.second.size(); ++id) cells.emplace_back(sheet.first, id);
+		}
+		std::mt19937 rng{ 9 };
+		std::uniform_int_distribution<size_t> cellDist{ 0, cells.size() - 1 };
+		std::uniform_real_distribution<float> depthDist{ -1.f, 0.f };
+		std::vector<size_t> picks(spriteCount);
+		for (auto& pick : picks) pick = cellDist(rng);
+		std::vector<Transform> transforms(spriteCount);
+		for (auto& t : transforms) t = Transform{ { 0.f, 0.f, depthDist(rng) }, { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f } };
+		std::vector<size_t> order(spriteCount);
+		std::iota(order.begin(), order.end(), size_t{});
+		std::sort(order.begin(), order.end(), [&transforms](size_t lhs, size_t rhs) { return transforms[lhs].position.z < transforms[rhs].position.z; });
+
+		for (int texUnits : { 16, 4 }) {
+			StubRenderer stub{ texUnits };
+			std::map<std::string, std::shared_ptr<Texture>> sheetTextures;
+			for (auto const& sheet : atlas->GetRegions()) sheetTextures[sheet.first] = std::make_shared<Texture>(sheet.first);
+			std::cout << "  " << spriteCount << " sprites over " << cells.size() << " frames of " << sheetTextures.size()
+				<< " sheets, " << texUnits << " units:";
+			for (bool isAtlas : { false, true }) {
+				std::vector<std::shared_ptr<SubTexture>> subtexs;
+				for (auto const& cell : cells) {
+					if (isAtlas) {
+						subtexs.push_back(SubTexture::Create(cell.first, cell.second));
+						continue;
+					}
+					std::shared_ptr<Texture> const& tex{ sheetTextures[cell.first] };
+					glm::vec2 size{ tex->GetWidth() / static_cast<float>(atlas->GetRegions().at(cell.first).size()), tex->GetHeight() };
+					subtexs.push_back(SubTexture::Create(tex, { cell.second, 0 }, size));
+				}
+				std::vector<QuadDraw> draws;
+				for (size_t i : order) draws.push_back(QuadDraw{ &transforms[i], subtexs[picks[i]].get(), { 1.f, 1.f, 1.f, 1.f }, 0.f });
+
+				Renderer::ResetStats();
+				Renderer::RenderSceneBegin(stub.camera);
+				Renderer::DrawQuadsInstanced(draws);
+				Renderer::RenderSceneEnd();
+				Statistics stats{ Renderer::GetStats() };
+				std::cout << (isAtlas ? ", atlas " : " sheets ") << stats.drawCalls << " draw calls ("
+					<< stats.GetFlushCount(FlushReason::TEXTURE_UNITS) << " out of units)";
+			}
+			std::cout << "\n";
+		}
+		return passed;
+	}
+}
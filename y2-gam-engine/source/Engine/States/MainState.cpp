@@ -11,6 +11,8 @@ void MainState::Init() {
 	mIsStep = false;
 	using namespace Serializer;
 	coordinator->GetSystem<Serializer::EntitySerializationSystem>()->LoadEntities("LevelData");
+	//the level is in, freeze its static geometry
+	coordinator->GetSystem<Collision::CollisionSystem>()->BakeTerrain();
 }
 void MainState::Exit() {
 	using namespace Serializer;
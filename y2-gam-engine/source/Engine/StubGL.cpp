@@ -0,0 +1,282 @@
+/******************************************************************************/
+/*!
+\par        Image Engine
+\file       StubGL.cpp
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief		stand in gl for the benchmarks
+
+			only the functions the renderer, its buffers, shaders,
+			textures and framebuffer call are stubbed, anything else is
+			left as glad loaded it (null before a context exists).
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+			or disclosure of this file or its contents without the prior
+			written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+#include "../include/pch.hpp"
+#include <Engine/StubGL.hpp>
+
+namespace {
+	StubGL::State state;
+
+	void NewHdls(GLsizei n, GLuint* hdls) {
+		for (GLsizei i{}; i < n; ++i) hdls[i] = state.nextHdl++;
+	}
+
+	void APIENTRY CreateHdls(GLsizei n, GLuint* hdls) { NewHdls(n, hdls); }
+	void APIENTRY CreateTextures(GLenum, GLsizei n, GLuint* hdls) { NewHdls(n, hdls); }
+	void APIENTRY DeleteHdls(GLsizei, GLuint const*) {}
+	void APIENTRY DeleteBuffers(GLsizei n, GLuint const* hdls) {
+		for (GLsizei i{}; i < n; ++i) state.bufferData.erase(hdls[i]);
+	}
+	GLuint APIENTRY CreateProgram() { return state.nextHdl++; }
+	GLuint APIENTRY CreateShader(GLenum) { return state.nextHdl++; }
+
+	void APIENTRY NoHdl(GLuint) {}
+	void APIENTRY NoEnum(GLenum) {}
+	void APIENTRY NoEnumEnum(GLenum, GLenum) {}
+	void APIENTRY NoHdlHdl(GLuint, GLuint) {}
+	void APIENTRY NoEnumHdl(GLenum, GLuint) {}
+	void APIENTRY NoEnumInt(GLenum, GLint) {}
+	void APIENTRY NoEnumEnumInt(GLenum, GLenum, GLint) {}
+	void APIENTRY NoHdlEnumInt(GLuint, GLenum, GLint) {}
+	void APIENTRY NoClearColor(GLfloat, GLfloat, GLfloat, GLfloat) {}
+	GLboolean APIENTRY NoUnmapBuffer(GLenum) { return GL_TRUE; }
+	void APIENTRY NoShaderSource(GLuint, GLsizei, GLchar const* const*, GLint const*) {}
+	void APIENTRY NoInfoLog(GLuint, GLsizei, GLsizei* length, GLchar* log) {
+		if (length) *length = 0;
+		if (log) *log = '\0';
+	}
+	void APIENTRY NoTexImage2D(GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, void const*) {}
+	void APIENTRY NoTexStorage2D(GLenum, GLsizei, GLenum, GLsizei, GLsizei) {}
+	void APIENTRY NoFramebufferTexture2D(GLenum, GLenum, GLenum, GLuint, GLint) {}
+	GLenum APIENTRY CheckFramebufferStatus(GLenum) { return GL_FRAMEBUFFER_COMPLETE; }
+	void APIENTRY NoDepthMask(GLboolean) {}
+	void APIENTRY NoTextureStorage2D(GLuint, GLsizei, GLenum, GLsizei, GLsizei) {}
+	void APIENTRY NoUniform1f(GLint, GLfloat) {}
+	void APIENTRY NoUniform1i(GLint, GLint) {}
+	void APIENTRY NoUniform1iv(GLint, GLsizei, GLint const*) {}
+	void APIENTRY NoUniform2f(GLint, GLfloat, GLfloat) {}
+	void APIENTRY NoUniform3f(GLint, GLfloat, GLfloat, GLfloat) {}
+	void APIENTRY NoUniform4f(GLint, GLfloat, GLfloat, GLfloat, GLfloat) {}
+	void APIENTRY NoUniformMatrix(GLint, GLsizei, GLboolean, GLfloat const*) {}
+	GLint APIENTRY UniformLocation(GLuint, GLchar const*) { return 0; }
+	//every fence is a distinct non null handle, already signalled when it is waited on
+	GLsync APIENTRY FenceSync(GLenum, GLbitfield) {
+		return reinterpret_cast<GLsync>(++state.fencesCreated);
+	}
+	GLenum APIENTRY ClientWaitSync(GLsync, GLbitfield, GLuint64) {
+		++state.fenceWaits;
+		return GL_ALREADY_SIGNALED;
+	}
+	void APIENTRY DeleteSync(GLsync) {}
+
+	void APIENTRY GetIntegerv(GLenum name, GLint* data) {
+		*data = name == GL_MAX_TEXTURE_IMAGE_UNITS ? state.maxTexUnits : 0;
+	}
+	//shaders always compile and link
+	void APIENTRY GetObjectiv(GLuint, GLenum name, GLint* data) {
+		*data = (name == GL_COMPILE_STATUS || name == GL_LINK_STATUS) ? GL_TRUE : 0;
+	}
+
+	void APIENTRY BindTextureUnit(GLuint unit, GLuint hdl) {
+		if (unit >= state.boundTextures.size()) state.boundTextures.resize(unit + 1);
+		state.boundTextures[unit] = hdl;
+	}
+	//only array buffers are kept, the element buffers are never read back
+	void APIENTRY BindBuffer(GLenum target, GLuint hdl) {
+		if (target == GL_ARRAY_BUFFER) state.boundArrayBuffer = hdl;
+	}
+	void APIENTRY BufferData(GLenum target, GLsizeiptr size, void const* data, GLenum) {
+		if (target != GL_ARRAY_BUFFER) return;
+		std::vector<unsigned char>& bytes{ state.bufferData[state.boundArrayBuffer] };
+		bytes.assign(static_cast<size_t>(size), 0);
+		if (data) std::memcpy(bytes.data(), data, static_cast<size_t>(size));
+	}
+	//immutable, so a mapping into it stays valid until the buffer is gone
+	void APIENTRY BufferStorage(GLenum target, GLsizeiptr size, void const* data, GLbitfield) {
+		BufferData(target, size, data, GL_STATIC_DRAW);
+	}
+	void* APIENTRY MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr size, GLbitfield) {
+		if (target != GL_ARRAY_BUFFER) return nullptr;
+		std::vector<unsigned char>& bytes{ state.bufferData[state.boundArrayBuffer] };
+		if (static_cast<size_t>(offset + size) > bytes.size()) return nullptr;
+		return bytes.data() + offset;
+	}
+	void APIENTRY BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void const* data) {
+		if (target != GL_ARRAY_BUFFER) return;
+		std::vector<unsigned char>& bytes{ state.bufferData[state.boundArrayBuffer] };
+		if (static_cast<size_t>(offset + size) > bytes.size()) bytes.resize(static_cast<size_t>(offset + size));
+		std::memcpy(bytes.data() + offset, data, static_cast<size_t>(size));
+	}
+	void APIENTRY BindVertexArray(GLuint hdl) {
+		state.boundVertexArray = hdl;
+	}
+	void APIENTRY VertexAttribPointer(GLuint idx, GLint, GLenum, GLboolean, GLsizei stride, void const*) {
+		std::vector<StubGL::State::Attrib>& attribs{ state.vertexArrays[state.boundVertexArray] };
+		if (idx >= attribs.size()) attribs.resize(idx + 1);
+		attribs[idx] = StubGL::State::Attrib{ state.boundArrayBuffer, static_cast<size_t>(stride), false };
+	}
+	void APIENTRY VertexAttribDivisor(GLuint idx, GLuint divisor) {
+		std::vector<StubGL::State::Attrib>& attribs{ state.vertexArrays[state.boundVertexArray] };
+		if (idx < attribs.size()) attribs[idx].isPerInstance = divisor != 0;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! FindDrawBuffer
+
+	@param isPerInstance Look for the instance buffer instead of the vertex buffer.
+
+	@return The first attribute of the bound vertex array that advances per
+	instance or per vertex, or nullptr if it has none.
+	*/
+	StubGL::State::Attrib const* FindDrawBuffer(bool isPerInstance) {
+		auto vao{ state.vertexArrays.find(state.boundVertexArray) };
+		if (vao == state.vertexArrays.end()) return nullptr;
+		for (auto const& attrib : vao->second) {
+			if (attrib.buffer && attrib.isPerInstance == isPerInstance) return &attrib;
+		}
+		return nullptr;
+	}
+	void APIENTRY TextureSubImage2D(GLuint hdl, GLint, GLint x, GLint y, GLsizei width, GLsizei height, GLenum, GLenum, void const* data) {
+		//only whole uploads are kept, every texture upload the engine makes is one
+		if (x || y || !data) return;
+		size_t size{ static_cast<size_t>(width) * static_cast<size_t>(height) * 4 };
+		std::vector<unsigned char>& bytes{ state.textureData[hdl] };
+		bytes.assign(static_cast<unsigned char const*>(data), static_cast<unsigned char const*>(data) + size);
+	}
+	void APIENTRY DrawElementsBaseVertex(GLenum, GLsizei count, GLenum, void const*, GLint baseVertex) {
+		++state.drawCalls;
+		state.indicesDrawn += static_cast<size_t>(count);
+		if (!state.onDraw) return;
+		StubGL::State::Attrib const* attrib{ FindDrawBuffer(false) };
+		std::vector<unsigned char> const* bytes{ attrib ? &state.bufferData[attrib->buffer] : nullptr };
+		size_t offset{ attrib ? static_cast<size_t>(baseVertex) * attrib->stride : 0 };
+		if (!bytes || offset > bytes->size()) state.onDraw(state, nullptr, 0, count);
+		else state.onDraw(state, bytes->data() + offset, bytes->size() - offset, count);
+	}
+	void APIENTRY DrawElements(GLenum mode, GLsizei count, GLenum type, void const* indices) {
+		DrawElementsBaseVertex(mode, count, type, indices, 0);
+	}
+	void APIENTRY DrawElementsInstancedBaseInstance(GLenum, GLsizei count, GLenum, void const*, GLsizei instances, GLuint baseInstance) {
+		++state.drawCalls;
+		state.indicesDrawn += static_cast<size_t>(count) * static_cast<size_t>(instances);
+		if (!state.onInstancedDraw) return;
+		StubGL::State::Attrib const* attrib{ FindDrawBuffer(true) };
+		std::vector<unsigned char> const* bytes{ attrib ? &state.bufferData[attrib->buffer] : nullptr };
+		state.onInstancedDraw(state, bytes ? bytes->data() : nullptr, bytes ? bytes->size() : 0,
+			static_cast<int>(baseInstance), instances);
+	}
+	void APIENTRY DrawArrays(GLenum, GLint, GLsizei) {
+		++state.lineDrawCalls;
+	}
+}
+
+namespace StubGL {
+	/*  _________________________________________________________________________ */
+	/*! Install
+
+	@param maxTexUnits The number of texture units the stub reports.
+	@param hasBufferStorage Report gl 4.4, so the renderer streams through
+	its persistently mapped rings, else it takes the SetData path.
+
+	@return none.
+
+	Points the glad functions at the stubs and clears the recorded state.
+	Call it before Renderer::Init and never once a real context is loaded.
+	*/
+	void Install(int maxTexUnits, bool hasBufferStorage) {
+		//handles keep counting, buffers of an earlier install are deleted after the new ones are made
+		unsigned int nextHdl{ state.nextHdl };
+		state = State{};
+		state.nextHdl = nextHdl;
+		state.maxTexUnits = maxTexUnits;
+		GLAD_GL_VERSION_4_4 = hasBufferStorage ? 1 : 0;
+
+		glad_glCreateBuffers = CreateHdls;
+		glad_glCreateVertexArrays = CreateHdls;
+		glad_glGenTextures = CreateHdls;
+		glad_glCreateTextures = CreateTextures;
+		glad_glDeleteBuffers = DeleteBuffers;
+		glad_glDeleteVertexArrays = DeleteHdls;
+		glad_glDeleteTextures = DeleteHdls;
+		glad_glCreateProgram = CreateProgram;
+		glad_glCreateShader = CreateShader;
+		glad_glDeleteProgram = NoHdl;
+		glad_glDeleteShader = NoHdl;
+		glad_glCompileShader = NoHdl;
+		glad_glLinkProgram = NoHdl;
+		glad_glUseProgram = NoHdl;
+		glad_glBindVertexArray = BindVertexArray;
+		glad_glEnableVertexAttribArray = NoHdl;
+		glad_glAttachShader = NoHdlHdl;
+		glad_glDetachShader = NoHdlHdl;
+		glad_glShaderSource = NoShaderSource;
+		glad_glGetShaderiv = GetObjectiv;
+		glad_glGetProgramiv = GetObjectiv;
+		glad_glGetShaderInfoLog = NoInfoLog;
+		glad_glGetProgramInfoLog = NoInfoLog;
+		glad_glGetUniformLocation = UniformLocation;
+		glad_glUniform1f = NoUniform1f;
+		glad_glUniform1i = NoUniform1i;
+		glad_glUniform1iv = NoUniform1iv;
+		glad_glUniform2f = NoUniform2f;
+		glad_glUniform3f = NoUniform3f;
+		glad_glUniform4f = NoUniform4f;
+		glad_glUniformMatrix3fv = NoUniformMatrix;
+		glad_glUniformMatrix4fv = NoUniformMatrix;
+
+		glad_glEnable = NoEnum;
+		glad_glClear = NoEnum;
+		glad_glBlendFunc = NoEnumEnum;
+		glad_glClearColor = NoClearColor;
+		glad_glGetIntegerv = GetIntegerv;
+		glad_glPixelStorei = NoEnumInt;
+
+		glad_glBindBuffer = BindBuffer;
+		glad_glBufferData = BufferData;
+		glad_glBufferStorage = BufferStorage;
+		glad_glBufferSubData = BufferSubData;
+		glad_glMapBufferRange = MapBufferRange;
+		glad_glUnmapBuffer = NoUnmapBuffer;
+		glad_glVertexAttribPointer = VertexAttribPointer;
+		glad_glVertexAttribDivisor = VertexAttribDivisor;
+		glad_glFenceSync = FenceSync;
+		glad_glClientWaitSync = ClientWaitSync;
+		glad_glDeleteSync = DeleteSync;
+
+		glad_glBindTexture = NoEnumHdl;
+		glad_glBindTextureUnit = BindTextureUnit;
+		glad_glTexImage2D = NoTexImage2D;
+		glad_glTexParameteri = NoEnumEnumInt;
+		glad_glTextureParameteri = NoHdlEnumInt;
+		glad_glTextureStorage2D = NoTextureStorage2D;
+		glad_glTextureSubImage2D = TextureSubImage2D;
+
+		glad_glCreateFramebuffers = CreateHdls;
+		glad_glDeleteFramebuffers = DeleteHdls;
+		glad_glBindFramebuffer = NoEnumHdl;
+		glad_glTexStorage2D = NoTexStorage2D;
+		glad_glFramebufferTexture2D = NoFramebufferTexture2D;
+		glad_glCheckFramebufferStatus = CheckFramebufferStatus;
+		glad_glDepthMask = NoDepthMask;
+
+		glad_glDrawElements = DrawElements;
+		glad_glDrawElementsBaseVertex = DrawElementsBaseVertex;
+		glad_glDrawElementsInstancedBaseInstance = DrawElementsInstancedBaseInstance;
+		glad_glDrawArrays = DrawArrays;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! GetState
+
+	@return What the stubs have recorded since Install.
+	*/
+	State& GetState() {
+		return state;
+	}
+}
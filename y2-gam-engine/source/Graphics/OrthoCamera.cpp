@@ -152,6 +152,29 @@ glm::mat4 const& OrthoCamera::GetViewMtx() const { return mViewMtx; }
 */
 glm::mat4 const& OrthoCamera::GetViewProjMtx() const { return mViewProjMtx;}
 
+/*  _________________________________________________________________________ */
+/*!
+\brief GetViewBounds
+
+Computes the world space rectangle the camera sees, by taking the corners
+of clip space back through the inverse view-projection. When the camera is
+rotated the rectangle is the box around the rotated view, so it can only
+be larger than what is seen.
+
+\param min Set to the bottom left corner of the rectangle.
+\param max Set to the top right corner of the rectangle.
+*/
+void OrthoCamera::GetViewBounds(glm::vec2& min, glm::vec2& max) const {
+	glm::mat4 invViewProj{ glm::inverse(mViewProjMtx) };
+	min = glm::vec2{ FLOAT_MAX };
+	max = glm::vec2{ -FLOAT_MAX };
+	for (glm::vec2 corner : { glm::vec2{ -1.f, -1.f }, glm::vec2{ 1.f, -1.f }, glm::vec2{ 1.f, 1.f }, glm::vec2{ -1.f, 1.f } }) {
+		glm::vec4 world{ invViewProj * glm::vec4{ corner, 0.f, 1.f } };
+		min = glm::min(min, glm::vec2{ world });
+		max = glm::max(max, glm::vec2{ world });
+	}
+}
+
 /*  _________________________________________________________________________ */
 /*!
 \brief ComputeViewProjMtx
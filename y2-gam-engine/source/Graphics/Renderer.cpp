@@ -23,18 +23,24 @@
 #include "Graphics/Renderer.hpp"
 #include "Components/Transform.hpp"
 #include <Core/Globals.hpp>
+#include <glm/gtc/packing.hpp>
+#include <future>
 
 RendererData Renderer::mData;
 
 /*  _________________________________________________________________________ */
 /*! Init
 
+@param usePersistentMapping (optional)
+Stream quads through a persistently mapped ring when the context supports it.
+Default is true, false forces the SetData path.
+
 @return none.
 
 Initializes the renderer.
 This method sets up OpenGL states, initializes data structures, and prepares shaders.
 */
-void Renderer::Init() {
+void Renderer::Init(bool usePersistentMapping) {
 
 	glEnable(GL_BLEND);
 	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
@@ -43,10 +49,32 @@ void Renderer::Init() {
 	mData.maxTexUnits = GetMaxTextureUnits();
 
 	mData.texUnits = std::vector<std::shared_ptr<Texture>>(mData.maxTexUnits);
+	mData.texSlots.clear();
 
 	mData.quadVertexArray = VertexArray::Create();
 
-	mData.quadVertexBuffer = VertexBuffer::Create(mData.cMaxVertices * sizeof(QuadVtx));
+	//quads are written straight into the mapped vbo, else into quadBuffer and copied on flush
+	mData.quadVertexBuffer = usePersistentMapping
+		? VertexBuffer::CreateMapped(mData.cMaxVertices * mData.cVtxSegments * sizeof(QuadVtx)) : nullptr;
+	mData.quadMapped = nullptr;
+	//fences left by earlier rings guard nothing in these ones
+	for (GLsync& fence : mData.quadFences) {
+		if (fence) glDeleteSync(fence);
+		fence = nullptr;
+	}
+	for (GLsync& fence : mData.instanceFences) {
+		if (fence) glDeleteSync(fence);
+		fence = nullptr;
+	}
+	mData.quadSegment = 0;
+	mData.instanceSegment = 0;
+	if (mData.quadVertexBuffer) {
+		mData.quadMapped = static_cast<QuadVtx*>(mData.quadVertexBuffer->GetMappedData());
+	}
+	else {
+		mData.quadVertexBuffer = VertexBuffer::Create(mData.cMaxVertices * sizeof(QuadVtx));
+		mData.quadBuffer = std::vector<QuadVtx>(mData.cMaxVertices);
+	}
 
 	BufferLayout quadLayout = {
 		{AttributeType::VEC3, "a_Position"},
@@ -57,8 +85,6 @@ void Renderer::Init() {
 
 	mData.quadVertexBuffer->SetLayout(quadLayout); //must set layout before adding vbo
 	mData.quadVertexArray->AddVertexBuffer(mData.quadVertexBuffer);
-	mData.quadBuffer = std::vector<QuadVtx>(mData.cMaxVertices);
-
 	std::vector<unsigned int> quadIndices(mData.cMaxIndices);
 
 
@@ -77,6 +103,41 @@ void Renderer::Init() {
 	std::shared_ptr<ElementBuffer> quadEbo = ElementBuffer::Create(quadIndices.data(), mData.cMaxIndices);
 	mData.quadVertexArray->SetElementBuffer(quadEbo);
 
+	//Instanced sprites, the corners of a unit quad are expanded by the shader per instance
+	float unitCorners[]{ -1.f, -1.f, 1.f, -1.f, 1.f, 1.f, -1.f, 1.f };
+	mData.unitQuadVertexBuffer = VertexBuffer::Create(unitCorners, sizeof(unitCorners));
+	BufferLayout cornerLayout = {
+		{AttributeType::VEC2, "a_Corner"}
+	};
+	mData.unitQuadVertexBuffer->SetLayout(cornerLayout);
+	mData.unitQuadElementBuffer = ElementBuffer::Create(quadIndices.data(), 6);
+
+	mData.instanceVertexBuffer = usePersistentMapping
+		? VertexBuffer::CreateMapped(mData.cMaxQuads * mData.cVtxSegments * sizeof(QuadInstance)) : nullptr;
+	mData.instanceMapped = nullptr;
+	if (mData.instanceVertexBuffer) {
+		mData.instanceMapped = static_cast<QuadInstance*>(mData.instanceVertexBuffer->GetMappedData());
+		mData.instanceBuffer = std::vector<QuadInstance>{};
+	}
+	else {
+		mData.instanceVertexBuffer = VertexBuffer::Create(mData.cMaxQuads * sizeof(QuadInstance));
+		mData.instanceBuffer = std::vector<QuadInstance>(mData.cMaxQuads);
+	}
+	mData.instanceLayout = {
+		{AttributeType::VEC3, "a_Position"},
+		{AttributeType::VEC2, "a_Scale"},
+		{AttributeType::VEC2, "a_CosSin"},
+		{AttributeType::VEC4, "a_TexRect"},
+		{AttributeType::UBYTE4, "a_Color", true},
+		{AttributeType::FLOAT, "a_TexIdx"}
+	};
+	mData.instanceVertexBuffer->SetLayout(mData.instanceLayout);
+
+	mData.instanceVertexArray = VertexArray::Create();
+	mData.instanceVertexArray->AddVertexBuffer(mData.unitQuadVertexBuffer);
+	mData.instanceVertexArray->AddVertexBuffer(mData.instanceVertexBuffer, true);
+	mData.instanceVertexArray->SetElementBuffer(mData.unitQuadElementBuffer);
+
 	//Lines
 	mData.lineVertexArray = VertexArray::Create();
 	mData.lineVertexBuffer = VertexBuffer::Create(mData.cMaxVertices * sizeof(LineVtx));
@@ -103,12 +164,18 @@ void Renderer::Init() {
 	mData.texShader = std::make_shared<Shader>("../Shaders/Tex.vert", "../Shaders/Tex.frag");
 	mData.texShader->Use();
 	mData.texShader->SetUniform("u_Tex", samplers.data(), mData.maxTexUnits);
+	mData.instanceShader = std::make_shared<Shader>("../Shaders/Instanced.vert", "../Shaders/Tex.frag");
+	mData.instanceShader->Use();
+	mData.instanceShader->SetUniform("u_Tex", samplers.data(), mData.maxTexUnits);
 
 	//Universal Mesh
 	mData.quadVtxPos[0] = { -0.5f, -0.5f, 0.0f, 1.0f };
 	mData.quadVtxPos[1] = { 0.5f, -0.5f, 0.0f, 1.0f };
 	mData.quadVtxPos[2] = { 0.5f,  0.5f, 0.0f, 1.0f };
 	mData.quadVtxPos[3] = { -0.5f, 0.5f, 0.0f, 1.0f };
+
+	//vertex generation for DrawQuads is split over this many threads
+	mData.vtxThreadCount = std::clamp(std::thread::hardware_concurrency(), 1u, RendererData::cMaxVtxThreads);
 }
 
 /*  _________________________________________________________________________ */
@@ -139,6 +206,9 @@ void Renderer::RenderSceneBegin(OrthoCamera const& camera) {
 	mData.texShader->Use();
 	mData.texShader->SetUniform("u_ViewProjMtx", camera.GetViewProjMtx());
 
+	mData.instanceShader->Use();
+	mData.instanceShader->SetUniform("u_ViewProjMtx", camera.GetViewProjMtx());
+
 	mData.lineShader->Use();
 	mData.lineShader->SetUniform("u_ViewProjMtx", camera.GetViewProjMtx());
 
@@ -155,6 +225,8 @@ Flushes the batch of primitives to be rendered.
 */
 void Renderer::RenderSceneEnd() {
 
+	if (mData.quadIdxCount || mData.lineVtxCount)
+		++mData.stats.flushes[static_cast<size_t>(FlushReason::SCENE_END)];
 	FlushBatch();
 }
 
@@ -222,6 +294,167 @@ void Renderer::SetLineBufferData(glm::vec3 const& pos, glm::vec4 const& clr) {
 	++mData.lineBufferPtr;
 }
 
+/*  _________________________________________________________________________ */
+/*! WriteQuadVertices
+
+@param out
+Where the 4 vertices are written.
+
+@param pos
+Center of the quad.
+
+@param scale
+Size of the quad.
+
+@param cosSin
+Cos and sin of the rotation of the quad as x and y.
+
+@param clr
+Color of the quad.
+
+@param texCoords
+The 4 texture coordinates, in the same order as the corners.
+
+@param texIdx
+Texture index for multi-texturing.
+
+@return One past the last vertex written.
+
+Writes the vertices of a 2D quad straight from its center, half extents and
+rotation, the same corners the translate * rotate * scale matrix would give
+without building it. Unrotated quads skip the rotation entirely. Makes no
+gl calls so it can run without a context.
+*/
+QuadVtx* Renderer::WriteQuadVertices(QuadVtx* out, glm::vec3 const& pos, glm::vec2 const& scale,
+	glm::vec2 const& cosSin, glm::vec4 const& clr, glm::vec2 const* texCoords, float texIdx) {
+	float hx{ scale.x * .5f }, hy{ scale.y * .5f };
+	if (cosSin.y == 0.f && cosSin.x == 1.f) {
+		out[0].pos = { pos.x - hx, pos.y - hy, pos.z };
+		out[1].pos = { pos.x + hx, pos.y - hy, pos.z };
+		out[2].pos = { pos.x + hx, pos.y + hy, pos.z };
+		out[3].pos = { pos.x - hx, pos.y + hy, pos.z };
+	}
+	else {
+		//the rotated half extents along the quad's own x and y axes
+		glm::vec2 axisX{ cosSin.x * hx, cosSin.y * hx };
+		glm::vec2 axisY{ -cosSin.y * hy, cosSin.x * hy };
+		out[0].pos = { pos.x - axisX.x - axisY.x, pos.y - axisX.y - axisY.y, pos.z };
+		out[1].pos = { pos.x + axisX.x - axisY.x, pos.y + axisX.y - axisY.y, pos.z };
+		out[2].pos = { pos.x + axisX.x + axisY.x, pos.y + axisX.y + axisY.y, pos.z };
+		out[3].pos = { pos.x - axisX.x + axisY.x, pos.y - axisX.y + axisY.y, pos.z };
+	}
+	for (size_t i{}; i < 4; ++i) {
+		out[i].clr = clr;
+		out[i].texCoord = texCoords[i];
+		out[i].texIdx = texIdx;
+	}
+	return out + 4;
+}
+
+/*  _________________________________________________________________________ */
+/*! SubmitQuad
+
+@param pos
+Center of the quad.
+
+@param scale
+Size of the quad.
+
+@param cosSin
+Cos and sin of the rotation of the quad as x and y.
+
+@param clr
+Color of the quad.
+
+@param texCoords
+The 4 texture coordinates.
+
+@param texIdx
+Texture index for multi-texturing.
+
+@return none.
+
+Appends a quad to the current batch, the caller makes sure it has room.
+*/
+void Renderer::SubmitQuad(glm::vec3 const& pos, glm::vec2 const& scale, glm::vec2 const& cosSin,
+	glm::vec4 const& clr, glm::vec2 const* texCoords, float texIdx) {
+	mData.quadBufferPtr = WriteQuadVertices(mData.quadBufferPtr, pos, scale, cosSin, clr, texCoords, texIdx);
+	mData.quadIdxCount += 6;
+
+	++mData.stats.quadCount;
+}
+
+/*  _________________________________________________________________________ */
+/*! TryGetTexIdx
+
+@param tex
+The texture to draw with.
+
+@param texIdx
+Set to the texture unit of the texture in the current batch.
+
+@return false if the texture is not bound yet and every unit is taken.
+
+Finds the unit the texture is bound to in this batch, adding it to the
+next free unit if it is not bound yet. The lookup goes through texSlots by
+the gl handle, so it costs the same however many units are in use.
+*/
+bool Renderer::TryGetTexIdx(std::shared_ptr<Texture> const& tex, float& texIdx) {
+	unsigned int hdl{ tex->GetTexHdl() };
+	if (hdl >= mData.texSlots.size())
+		mData.texSlots.resize(hdl + 1);
+
+	TexSlot& slot{ mData.texSlots[hdl] };
+	if (slot.batch == mData.texBatch) { //already set in this batch
+		texIdx = static_cast<float>(slot.unit);
+		return true;
+	}
+	if (mData.texUnitIdx >= mData.maxTexUnits)
+		return false;
+
+	slot = TexSlot{ mData.texBatch, mData.texUnitIdx };
+	texIdx = static_cast<float>(mData.texUnitIdx);
+	mData.texUnits[mData.texUnitIdx] = tex;
+	++mData.texUnitIdx;
+	return true;
+}
+
+/*  _________________________________________________________________________ */
+/*! GetTexIdx
+
+@param tex
+The texture to draw with.
+
+@return The texture unit of the texture in the current batch.
+
+Same as TryGetTexIdx, but starts a new batch when every unit is taken.
+Only call it before any vertex of the quad is written.
+*/
+float Renderer::GetTexIdx(std::shared_ptr<Texture> const& tex) {
+	float texIdx{};
+	if (!TryGetTexIdx(tex, texIdx)) {
+		NextBatch(FlushReason::TEXTURE_UNITS);
+		TryGetTexIdx(tex, texIdx);
+	}
+	return texIdx;
+}
+
+/*  _________________________________________________________________________ */
+/*! RotationCosSin
+
+@param rot
+Rotation in degrees.
+
+@return The cos and sin of the rotation as x and y.
+
+Exactly (1, 0) for no rotation so those quads take the unrotated path.
+*/
+static glm::vec2 RotationCosSin(float rot) {
+	glm::vec2 cosSin{ 1.f, 0.f };
+	if (rot != 0.f) Image::SinCos(glm::radians(rot), cosSin.y, cosSin.x);
+	return cosSin;
+}
+
 /*  _________________________________________________________________________ */
 /*! DrawQuad
 
@@ -244,23 +477,66 @@ Draws a flat-colored quad.
 void Renderer::DrawQuad(glm::vec3 const& pos, glm::vec2 const& scale, glm::vec4 const& clr, float rot) {
 
 	if (mData.quadIdxCount >= RendererData::cMaxIndices)
-		NextBatch();
+		NextBatch(FlushReason::INDICES);
 
 	constexpr glm::vec2 texCoords[4]{ { 0.f, 0.f }, {1.f, 0.f}, {1.f, 1.f}, {0.f, 1.f} };
 
 	const float texIdx{}; //white tex index = 0
 
-	glm::mat4 translateMtx{ glm::translate(glm::mat4{ 1.f }, pos) };
-	glm::mat4 rotateMtx{ glm::rotate(glm::mat4{ 1.f }, glm::radians(rot), {0.f, 0.f, 1.f}) };
-	glm::mat4 scaleMtx{ glm::scale(glm::mat4{ 1.f }, { scale.x, scale.y, 1.f }) };
-	glm::mat4 transformMtx{ translateMtx * rotateMtx * scaleMtx };
+	SubmitQuad(pos, scale, RotationCosSin(rot), clr, texCoords, texIdx);
+}
+
+/*  _________________________________________________________________________ */
+/*! DrawQuad (Overloaded)
+
+@param transform
+Transform object containing position, scale, and rotation information.
+
+@param clr
+Color of the quad.
+
+@return none.
+
+Draws a flat-colored quad with the rotation cached in the transform.
+*/
+void Renderer::DrawQuad(Transform const& transform, glm::vec4 const& clr) {
+
+	if (mData.quadIdxCount >= RendererData::cMaxIndices)
+		NextBatch(FlushReason::INDICES);
+
+	constexpr glm::vec2 texCoords[4]{ { 0.f, 0.f }, {1.f, 0.f}, {1.f, 1.f}, {0.f, 1.f} };
+
+	SubmitQuad(transform.position, transform.scale, transform.GetRotationCosSin(), clr, texCoords, 0.f);
+}
+
+/*  _________________________________________________________________________ */
+/*! DrawQuad (Overloaded)
+
+@param transformMtx
+World matrix of the quad, e.g. Transform::GetMatrix.
+
+@param clr
+Color of the quad.
+
+@return none.
+
+Draws a flat-colored quad with an already built matrix.
+*/
+void Renderer::DrawQuad(glm::mat4 const& transformMtx, glm::vec4 const& clr) {
+
+	if (mData.quadIdxCount >= RendererData::cMaxIndices)
+		NextBatch(FlushReason::INDICES);
+
+	constexpr glm::vec2 texCoords[4]{ { 0.f, 0.f }, {1.f, 0.f}, {1.f, 1.f}, {0.f, 1.f} };
+
+	const float texIdx{}; //white tex index = 0
 
 	for (size_t i{}; i < 4; ++i)
-		SetQuadBufferData(transformMtx * mData.quadVtxPos[i], scale, clr, texCoords[i], texIdx);
+		SetQuadBufferData(transformMtx * mData.quadVtxPos[i], {}, clr, texCoords[i], texIdx);
 
 	mData.quadIdxCount += 6;
 
-	//++mData.stats.quadCount;
+	++mData.stats.quadCount;
 }
 
 /*  _________________________________________________________________________ */
@@ -288,38 +564,12 @@ This overloaded version draws a textured quad.
 void Renderer::DrawQuad(glm::vec3 const& pos, glm::vec2 const& scale,
 	std::shared_ptr<Texture>const& tex, float rot) {
 	if (mData.quadIdxCount >= RendererData::cMaxIndices)
-		NextBatch();
+		NextBatch(FlushReason::INDICES);
 
 	constexpr glm::vec4 clr{ 1.f, 1.f, 1.f, 1.f }; //TODO add parameter tint
 	constexpr glm::vec2 texCoords[4]{ { 0.f, 0.f }, {1.f, 0.f}, {1.f, 1.f}, {0.f, 1.f} };
 
-	float texIdx = 0.f;
-
-	//don't need to iterate all 32 slots every time
-	for (unsigned int i{ 1 }; i < mData.texUnitIdx; ++i) {
-		if (*mData.texUnits[i].get() == *tex.get()) { //check if the particular texture has already been set
-			texIdx = static_cast<float>(i);
-			break;
-		}
-	}
-
-	if (texIdx == 0.f) {
-		texIdx = static_cast<float>(mData.texUnitIdx);
-		mData.texUnits[mData.texUnitIdx] = tex;
-		++mData.texUnitIdx;
-	}
-
-	glm::mat4 translateMtx{ glm::translate(glm::mat4{ 1.f }, pos) };
-	glm::mat4 rotateMtx{ glm::rotate(glm::mat4{ 1.f }, glm::radians(rot), {0.f, 0.f, 1.f}) };
-	glm::mat4 scaleMtx{ glm::scale(glm::mat4{ 1.f }, { scale.x, scale.y, 1.f }) };
-	glm::mat4 transformMtx{ translateMtx * rotateMtx * scaleMtx };
-
-	for (size_t i{}; i < 4; ++i)
-		SetQuadBufferData(transformMtx * mData.quadVtxPos[i], scale, clr, texCoords[i], texIdx);
-
-	mData.quadIdxCount += 6;
-
-	//++mData.stats.quadCount;
+	SubmitQuad(pos, scale, RotationCosSin(rot), clr, texCoords, GetTexIdx(tex));
 }
 
 /*  _________________________________________________________________________ */
@@ -346,48 +596,51 @@ Rotation of the sprite. Default is 0.0f.
 This function is responsible for drawing a sprite on the screen. It checks if 
 the maximum indices have been reached and if so, it moves to the next batch.
 The function also checks if a particular texture has already been set to avoid
-unnecessary texture bindings. The sprite's position, scale, and rotation are combined
-to form a transformation matrix which is then used to set the quad buffer data. The
+unnecessary texture bindings. The corners are computed directly from the
+position, half of the scale and the sin and cos of the rotation, and the
 function increments the quad index count by 6 for each sprite drawn.
 
 */
-//TODO Add duplicated code in function
 void Renderer::DrawSprite(glm::vec3 const& pos, glm::vec2 const& scale, std::shared_ptr<SubTexture>const& subtex, glm::vec4 const& tint, float rot) {
 
 	if (mData.quadIdxCount >= RendererData::cMaxIndices)
-		NextBatch();
+		NextBatch(FlushReason::INDICES);
 
-	glm::vec2 const* texCoords{ subtex->GetTexCoords() };
-	std::shared_ptr<Texture> tex = subtex->GetTexture();
+	SubmitQuad(pos, scale, RotationCosSin(rot), tint, subtex->GetTexCoords(), GetTexIdx(subtex->GetTexture()));
+}
 
-	float texIdx = 0.f;
+/*  _________________________________________________________________________ */
+/*! DrawSprite (Overloaded)
 
-	//don't need to iterate all 32 slots every time
-	for (unsigned int i{ 1 }; i < mData.texUnitIdx; ++i) {
-		if (*mData.texUnits[i].get() == *tex.get()) { //check if the particular texture has already been set
-			texIdx = static_cast<float>(i);
-			break;
-		}
-	}
+@param transformMtx
+World matrix of the sprite, e.g. Transform::GetMatrix.
 
-	if (texIdx == 0.f) {
-		texIdx = static_cast<float>(mData.texUnitIdx);
-		mData.texUnits[mData.texUnitIdx] = tex;
-		++mData.texUnitIdx;
-	}
+@param subtex
+A shared pointer to the SubTexture object which contains the texture information
+for the sprite.
 
-	glm::mat4 translateMtx{ glm::translate(glm::mat4{ 1.f }, pos) };
-	glm::mat4 rotateMtx{ glm::rotate(glm::mat4{ 1.f }, glm::radians(rot), {0.f, 0.f, 1.f}) };
-	glm::mat4 scaleMtx{ glm::scale(glm::mat4{ 1.f }, { scale.x, scale.y, 1.f }) };
+@param tint
+Color tint to be applied to the sprite.
 
-	glm::mat4 transformMtx{ translateMtx * rotateMtx * scaleMtx };
+@return none.
+
+Draws a sprite with an already built matrix, for transforms that are not a
+plain 2D position, rotation and scale.
+*/
+void Renderer::DrawSprite(glm::mat4 const& transformMtx, std::shared_ptr<SubTexture> const& subtex, glm::vec4 const& tint) {
+
+	if (mData.quadIdxCount >= RendererData::cMaxIndices)
+		NextBatch(FlushReason::INDICES);
+
+	glm::vec2 const* texCoords{ subtex->GetTexCoords() };
+	float texIdx{ GetTexIdx(subtex->GetTexture()) };
 
 	for (size_t i{}; i < 4; ++i) 
-		SetQuadBufferData(transformMtx * mData.quadVtxPos[i], scale, tint, texCoords[i], texIdx);
+		SetQuadBufferData(transformMtx * mData.quadVtxPos[i], {}, tint, texCoords[i], texIdx);
 
 	mData.quadIdxCount += 6;
 
-	//++mData.stats.quadCount;
+	++mData.stats.quadCount;
 }
 
 /*  _________________________________________________________________________ */
@@ -406,11 +659,388 @@ Color tint to be applied to the sprite.
 @return none.
 
 This function is an overloaded version of the DrawSprite function. It uses the
-transform object to extract position, scale, and rotation information and then
-calls the primary DrawSprite function.
+transform object to extract position and scale and the sin and cos of the
+rotation it caches, so sprites that did not turn skip the trig.
 */
 void Renderer::DrawSprite(Transform const& transform, std::shared_ptr<SubTexture> const& subtex, glm::vec4 const& tint) {
-	DrawSprite(transform.position, transform.scale, subtex, tint, transform.rotation.z);
+
+	if (mData.quadIdxCount >= RendererData::cMaxIndices)
+		NextBatch(FlushReason::INDICES);
+
+	SubmitQuad(transform.position, transform.scale, transform.GetRotationCosSin(), tint,
+		subtex->GetTexCoords(), GetTexIdx(subtex->GetTexture()));
+}
+
+/*  _________________________________________________________________________ */
+/*! ForEachSlice
+
+@param count
+Number of quads.
+
+@param threadCount
+Most threads to split the work over, the calling thread is one of them.
+
+@param writeSlice
+Called with the first and one past the last quad of each slice.
+
+@return none.
+
+Splits the quads into contiguous slices, one per thread, and waits for
+all of them. Small counts stay on the calling thread.
+*/
+template <typename SliceFn>
+static void ForEachSlice(size_t count, unsigned int threadCount, SliceFn const& writeSlice) {
+	size_t slices{ std::min<size_t>(std::max(threadCount, 1u), (count + RendererData::cMinQuadsPerThread - 1) / RendererData::cMinQuadsPerThread) };
+	if (slices <= 1) {
+		writeSlice(0, count);
+		return;
+	}
+	size_t sliceSize{ (count + slices - 1) / slices };
+	std::vector<std::future<void>> workers;
+	workers.reserve(slices - 1);
+	for (size_t i{ 1 }; i < slices; ++i) {
+		workers.emplace_back(std::async(std::launch::async, writeSlice,
+			std::min(count, i * sliceSize), std::min(count, (i + 1) * sliceSize)));
+	}
+	writeSlice(0, sliceSize);
+	for (auto& worker : workers) worker.get();
+}
+
+/*  _________________________________________________________________________ */
+/*! WriteQuadDrawVertices
+
+@param draws
+The quads to write, their texture index already assigned.
+
+@param count
+Number of quads.
+
+@param out
+Where the vertices are written, 4 per quad in the same order as the draws.
+
+@param threadCount
+Most threads to split the work over, the calling thread is one of them.
+
+@return none.
+
+Splits the quads into contiguous slices, one per thread, and each thread
+writes its slice into its own part of the buffer, so the result is the
+same bytes no matter how many threads are used. Small batches stay on the
+calling thread. Makes no gl calls. Each Transform may only appear once as
+reading it refreshes its cached rotation.
+*/
+void Renderer::WriteQuadDrawVertices(QuadDraw const* draws, size_t count, QuadVtx* out, unsigned int threadCount) {
+	ForEachSlice(count, threadCount, [draws, out](size_t first, size_t last) {
+		constexpr glm::vec2 texCoords[4]{ { 0.f, 0.f }, {1.f, 0.f}, {1.f, 1.f}, {0.f, 1.f} };
+		QuadVtx* vtx{ out + first * 4 };
+		for (size_t i{ first }; i < last; ++i) {
+			QuadDraw const& draw{ draws[i] };
+			vtx = WriteQuadVertices(vtx, draw.transform->position, draw.transform->scale, draw.transform->GetRotationCosSin(),
+				draw.color, draw.subtex ? draw.subtex->GetTexCoords() : texCoords, draw.texIdx);
+		}
+	});
+}
+
+/*  _________________________________________________________________________ */
+/*! WriteQuadInstances
+
+@param draws
+The quads to write, their texture index already assigned.
+
+@param count
+Number of quads.
+
+@param out
+Where the instances are written, 1 per quad in the same order as the draws.
+
+@param threadCount
+Most threads to split the work over, the calling thread is one of them.
+
+@return none.
+
+The instanced version of WriteQuadDrawVertices, split over threads the same
+way. Only the center, size, rotation, the corners of the texture and the
+color packed to rgba8 are written, the shader makes the 4 corners from
+them the way WriteQuadVertices does. Makes no gl calls.
+*/
+void Renderer::WriteQuadInstances(QuadDraw const* draws, size_t count, QuadInstance* out, unsigned int threadCount) {
+	ForEachSlice(count, threadCount, [draws, out](size_t first, size_t last) {
+		for (size_t i{ first }; i < last; ++i) {
+			QuadDraw const& draw{ draws[i] };
+			QuadInstance& instance{ out[i] };
+			instance.pos = draw.transform->position;
+			instance.scale = draw.transform->scale;
+			instance.cosSin = draw.transform->GetRotationCosSin();
+			if (draw.subtex) {
+				glm::vec2 const* texCoords{ draw.subtex->GetTexCoords() };
+				instance.texRect = { texCoords[0], texCoords[2] };
+			}
+			else {
+				instance.texRect = { 0.f, 0.f, 1.f, 1.f };
+			}
+			instance.clr = glm::packUnorm4x8(draw.color);
+			instance.texIdx = draw.texIdx;
+		}
+	});
+}
+
+/*  _________________________________________________________________________ */
+/*! DrawQuads
+
+@param draws
+The quads to draw, in draw order.
+
+@return none.
+
+Draws a whole sorted queue of quads. Texture units and room in the batch
+are handed out to the quads in order on the calling thread, splitting the
+queue into runs that fit in one batch. The vertices of each run are then
+written by WriteQuadDrawVertices straight into the batch buffer, the run
+is appended and the next run starts a new batch if needed. Gives the
+same batches and vertices as drawing the quads one by one.
+*/
+void Renderer::DrawQuads(std::vector<QuadDraw>& draws) {
+	size_t first{};
+	while (first < draws.size()) {
+		size_t room{ (RendererData::cMaxIndices - mData.quadIdxCount) / 6 };
+		size_t last{ first };
+		for (; last < draws.size() && last - first < room; ++last) {
+			QuadDraw& draw{ draws[last] };
+			if (!draw.subtex) {
+				draw.texIdx = 0.f; //white tex
+			}
+			else if (!TryGetTexIdx(draw.subtex->GetTexture(), draw.texIdx)) {
+				break;
+			}
+		}
+		if (last == first) {
+			NextBatch(room ? FlushReason::TEXTURE_UNITS : FlushReason::INDICES);
+			continue;
+		}
+
+		auto start{ std::chrono::steady_clock::now() };
+		WriteQuadDrawVertices(draws.data() + first, last - first, mData.quadBufferPtr, mData.vtxThreadCount);
+		mData.stats.vtxGenMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		mData.quadBufferPtr += (last - first) * 4;
+		mData.quadIdxCount += static_cast<unsigned int>((last - first) * 6);
+		mData.stats.quadCount += static_cast<unsigned int>(last - first);
+		first = last;
+	}
+}
+
+/*  _________________________________________________________________________ */
+/*! DrawQuadsInstanced
+
+@param draws
+The quads to draw, in draw order.
+
+@return none.
+
+Draws a whole sorted queue of quads as instances of one unit quad, so a
+sprite costs one QuadInstance instead of 4 vertices. Quads batched before
+it are drawn first to keep the draw order. The queue is cut into chunks
+that fit the instance buffer, each drawn by DrawInstanceChunk.
+*/
+void Renderer::DrawQuadsInstanced(std::vector<QuadDraw>& draws) {
+	if (mData.quadIdxCount)
+		NextBatch(FlushReason::INSTANCED);
+
+	for (size_t first{}; first < draws.size(); first += RendererData::cMaxQuads) {
+		if (first)
+			++mData.stats.flushes[static_cast<size_t>(FlushReason::INDICES)];
+		size_t count{ std::min<size_t>(draws.size() - first, RendererData::cMaxQuads) };
+		DrawInstanceChunk(draws.data() + first, count);
+	}
+}
+
+/*  _________________________________________________________________________ */
+/*! DrawInstanceChunk
+
+@param draws
+The quads to draw, at most cMaxQuads.
+
+@return none.
+
+Splits the quads into texture runs, writes all of their instances in one
+go and draws the runs. The instances are written in place into the next
+segment of the mapped ring once its fence has passed, and the segment is
+fenced after the draws, else they are written to instanceBuffer and
+uploaded with SetData.
+*/
+void Renderer::DrawInstanceChunk(QuadDraw* draws, size_t count) {
+	SplitInstanceRuns(draws, count, mData.instanceRuns, mData.runTextures);
+	mData.stats.flushes[static_cast<size_t>(FlushReason::TEXTURE_UNITS)] += static_cast<unsigned int>(mData.instanceRuns.size() - 1);
+
+	QuadInstance* out{ mData.instanceBuffer.data() };
+	unsigned int baseInstance{};
+	if (mData.instanceMapped) {
+		WaitForSegment(mData.instanceFences[mData.instanceSegment]);
+		baseInstance = mData.instanceSegment * RendererData::cMaxQuads;
+		out = mData.instanceMapped + baseInstance;
+	}
+
+	auto start{ std::chrono::steady_clock::now() };
+	WriteQuadInstances(draws, count, out, mData.vtxThreadCount);
+	auto written{ std::chrono::steady_clock::now() };
+	mData.stats.vtxGenMs += std::chrono::duration<double, std::milli>(written - start).count();
+
+	unsigned int dataSize{ static_cast<unsigned int>(count * sizeof(QuadInstance)) };
+	if (!mData.instanceMapped) {
+		mData.instanceVertexBuffer->SetData(mData.instanceBuffer.data(), dataSize);
+	}
+	mData.stats.uploadBytes += dataSize;
+
+	DrawInstanceRuns(mData.instanceVertexArray, mData.instanceRuns, mData.runTextures, baseInstance);
+	if (mData.instanceMapped) {
+		mData.instanceFences[mData.instanceSegment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		mData.instanceSegment = (mData.instanceSegment + 1) % RendererData::cVtxSegments;
+	}
+	mData.stats.quadCount += static_cast<unsigned int>(count);
+	mData.stats.submitMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - written).count();
+}
+
+/*  _________________________________________________________________________ */
+/*! SplitInstanceRuns
+
+@param draws
+The quads to split.
+
+@param count
+Number of quads.
+
+@param runs
+Set to the runs of quads that fit in the texture units, in order.
+
+@param textures
+Set to the textures each run binds, unit by unit.
+
+@return none.
+
+Hands out texture units to the quads in order, ending a run whenever they
+run out. Only call it with no quads batched, it leaves every texture unit
+of the batch free behind it. Lines batched so far are kept.
+*/
+void Renderer::SplitInstanceRuns(QuadDraw* draws, size_t count, std::vector<InstanceRun>& runs,
+	std::vector<std::shared_ptr<Texture>>& textures) {
+	runs.clear();
+	textures.clear();
+	auto endRun = [&runs, &textures](size_t last) {
+		unsigned int first{ runs.empty() ? 0u : runs.back().first + runs.back().count };
+		runs.push_back(InstanceRun{ first, static_cast<unsigned int>(last) - first,
+			static_cast<unsigned int>(textures.size()), mData.texUnitIdx });
+		textures.insert(textures.end(), mData.texUnits.begin(), mData.texUnits.begin() + mData.texUnitIdx);
+		//only the units are handed out again, a full BeginBatch would drop the lines
+		mData.texUnitIdx = 1;
+		++mData.texBatch;
+	};
+	for (size_t i{}; i < count; ++i) {
+		QuadDraw& draw{ draws[i] };
+		if (!draw.subtex) {
+			draw.texIdx = 0.f; //white tex
+		}
+		else if (!TryGetTexIdx(draw.subtex->GetTexture(), draw.texIdx)) {
+			endRun(i);
+			TryGetTexIdx(draw.subtex->GetTexture(), draw.texIdx);
+		}
+	}
+	endRun(count);
+}
+
+/*  _________________________________________________________________________ */
+/*! DrawInstanceRuns
+
+@param vao
+The unit quad and the instances of the runs.
+
+@param runs
+The runs to draw.
+
+@param textures
+The textures of the runs.
+
+@param baseInstance (optional)
+Where the instances of the runs start in the instance buffer.
+
+@return none.
+
+Draws each run with its own textures bound, starting at its first
+instance.
+*/
+void Renderer::DrawInstanceRuns(std::shared_ptr<VertexArray> const& vao, std::vector<InstanceRun> const& runs,
+	std::vector<std::shared_ptr<Texture>> const& textures, unsigned int baseInstance) {
+	mData.instanceShader->Use();
+	for (InstanceRun const& run : runs) {
+		for (unsigned int i{}; i < run.texCount; ++i) {
+			textures[run.firstTex + i]->Bind(i);
+		}
+		DrawIndexedInstanced(vao, run.count, baseInstance + run.first);
+		++mData.stats.drawCalls;
+	}
+}
+
+/*  _________________________________________________________________________ */
+/*! BuildStaticBatch
+
+@param draws
+The quads to bake, in draw order.
+
+@param batch
+Replaced with the baked quads, dropping what it held.
+
+@return none.
+
+Writes the instances of the quads once into a buffer of their own that is
+kept until the batch is built again, split into texture runs like
+DrawQuadsInstanced. Quads batched before it are drawn first, as building
+hands out the texture units. The upload is counted in the stats of the
+frame it is built in.
+*/
+void Renderer::BuildStaticBatch(std::vector<QuadDraw>& draws, StaticBatch& batch) {
+	batch = StaticBatch{};
+	if (draws.empty())
+		return;
+	if (mData.quadIdxCount)
+		NextBatch(FlushReason::INSTANCED);
+
+	SplitInstanceRuns(draws.data(), draws.size(), batch.runs, batch.textures);
+	std::vector<QuadInstance> instances(draws.size());
+	WriteQuadInstances(draws.data(), draws.size(), instances.data(), mData.vtxThreadCount);
+
+	unsigned int dataSize{ static_cast<unsigned int>(instances.size() * sizeof(QuadInstance)) };
+	std::shared_ptr<VertexBuffer> instanceVbo = VertexBuffer::Create(reinterpret_cast<float*>(instances.data()), dataSize);
+	instanceVbo->SetLayout(mData.instanceLayout);
+	batch.vertexArray = VertexArray::Create();
+	batch.vertexArray->AddVertexBuffer(mData.unitQuadVertexBuffer);
+	batch.vertexArray->AddVertexBuffer(instanceVbo, true);
+	batch.vertexArray->SetElementBuffer(mData.unitQuadElementBuffer);
+	batch.quadCount = static_cast<unsigned int>(draws.size());
+
+	mData.stats.uploadBytes += dataSize;
+	++mData.stats.staticBuilds;
+}
+
+/*  _________________________________________________________________________ */
+/*! DrawStaticBatch
+
+@param batch
+A batch from BuildStaticBatch.
+
+@return none.
+
+Draws the baked quads with one call per texture run and nothing uploaded.
+Quads batched before it are drawn first to keep the draw order.
+*/
+void Renderer::DrawStaticBatch(StaticBatch const& batch) {
+	if (!batch.quadCount)
+		return;
+	if (mData.quadIdxCount)
+		NextBatch(FlushReason::INSTANCED);
+
+	auto start{ std::chrono::steady_clock::now() };
+	DrawInstanceRuns(batch.vertexArray, batch.runs, batch.textures);
+	mData.stats.quadCount += batch.quadCount;
+	mData.stats.staticQuadCount += batch.quadCount;
+	mData.stats.submitMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
 }
 
 /*  _________________________________________________________________________ */
@@ -433,14 +1063,14 @@ function sets the buffer data for the line and increments the line vertex count.
 */
 void Renderer::DrawLine(glm::vec3 const& p0, glm::vec3 const& p1, glm::vec4 const& clr) {
 	if (mData.lineVtxCount >= RendererData::cMaxVertices)
-		NextBatch();
+		NextBatch(FlushReason::LINES);
 
 	SetLineBufferData(p0, clr);
 	SetLineBufferData(p1, clr);
 
 	mData.lineVtxCount += 2;
 
-	//++mData.stats.lineCount;
+	++mData.stats.lineCount;
 }
 
 /*  _________________________________________________________________________ */
@@ -485,25 +1115,40 @@ void Renderer::DrawLineRect(glm::vec3 const& pos, glm::vec2 const& scale, glm::v
 This function flushes the current batch of data to the GPU. It checks if
 there are any quads or lines to be drawn and then sends the data to the GPU.
 The function also binds the necessary textures and shaders before drawing.
+Quads in the mapped ring are drawn in place and fenced, and the next batch
+moves on to the next segment. The draw calls, vertex bytes and time taken
+are added to the stats.
 */
 void Renderer::FlushBatch() {
+	auto start{ std::chrono::steady_clock::now() };
 	if (mData.quadIdxCount) {
 		ptrdiff_t difference{ reinterpret_cast<unsigned char*>(mData.quadBufferPtr)
-							- reinterpret_cast<unsigned char*>(mData.quadBuffer.data()) };
+							- reinterpret_cast<unsigned char*>(GetBatchStart()) };
 
 		//how many elements it takes up in terms of bytes
 		unsigned int dataSize = static_cast<unsigned int>(difference);
+		mData.stats.uploadBytes += dataSize;
 
-		mData.quadVertexBuffer->SetData(mData.quadBuffer.data(), dataSize);
+		//mapped batches are already in the vbo, only the fallback copies
+		if (!mData.quadMapped) {
+			mData.quadVertexBuffer->SetData(mData.quadBuffer.data(), dataSize);
+		}
 
 		//Bind all the textures that has been set
 		for (unsigned int i{}; i < mData.texUnitIdx; ++i) {
 			mData.texUnits[i]->Bind(i);
 		}
 		mData.texShader->Use();
-		DrawIndexed(mData.quadVertexArray, mData.quadIdxCount);
+		//a mapped batch starts at its segment in the ring
+		int baseVtx{ mData.quadMapped ? static_cast<int>(mData.quadSegment * RendererData::cMaxVertices) : 0 };
+		DrawIndexed(mData.quadVertexArray, mData.quadIdxCount, baseVtx);
+
+		if (mData.quadMapped) {
+			mData.quadFences[mData.quadSegment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			mData.quadSegment = (mData.quadSegment + 1) % RendererData::cVtxSegments;
+		}
 
-		//++mData.stats.drawCalls;
+		++mData.stats.drawCalls;
 	}
 
 	if (mData.lineVtxCount) {
@@ -513,12 +1158,51 @@ void Renderer::FlushBatch() {
 		//how many elements it takes up in terms of bytes
 		unsigned int dataSize = static_cast<unsigned int>(difference);
 		mData.lineVertexBuffer->SetData(mData.lineBuffer.data(), dataSize);
+		mData.stats.uploadBytes += dataSize;
 
 		mData.lineShader->Use();
 		DrawLineArray(mData.lineVertexArray, mData.lineVtxCount);
 
-		//++mData.stats.drawCalls;
+		++mData.stats.drawCalls;
 	}
+	mData.stats.submitMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*  _________________________________________________________________________ */
+/*! GetBatchStart
+
+@return Where the vertices of the current batch start.
+
+The current segment of the mapped ring, or quadBuffer on the fallback path.
+*/
+QuadVtx* Renderer::GetBatchStart() {
+	if (mData.quadMapped)
+		return mData.quadMapped + mData.quadSegment * RendererData::cMaxVertices;
+	return mData.quadBuffer.data();
+}
+
+/*  _________________________________________________________________________ */
+/*! WaitForSegment
+
+@param fence
+The fence of a segment of a mapped ring, null if nothing was drawn from it.
+
+@return none.
+
+Waits for the gpu to finish the draws that last read the segment, then
+deletes the fence. The wait is counted as submit time in the stats.
+*/
+void Renderer::WaitForSegment(GLsync& fence) {
+	if (!fence)
+		return;
+	auto start{ std::chrono::steady_clock::now() };
+	GLenum result{};
+	do {
+		result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000);
+	} while (result == GL_TIMEOUT_EXPIRED);
+	glDeleteSync(fence);
+	fence = nullptr;
+	mData.stats.submitMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
 }
 
 /*  _________________________________________________________________________ */
@@ -527,38 +1211,40 @@ void Renderer::FlushBatch() {
 @return none.
 
 This function initializes a new batch by resetting the quad index count, line
-vertex count, and texture unit index. It also sets the buffer pointers to the
-start of the buffer data.
+vertex count, and texture unit index, which also drops every texture
+slot of the last batch. It also sets the buffer pointers to the
+start of the buffer data. When streaming through the mapped ring it first
+waits on the fence of the segment the batch is about to write.
 */
 void Renderer::BeginBatch() {
 	mData.quadIdxCount = 0;
-	mData.quadBufferPtr = mData.quadBuffer.data();
+	if (mData.quadMapped) {
+		WaitForSegment(mData.quadFences[mData.quadSegment]);
+	}
+	mData.quadBufferPtr = GetBatchStart();
 	//mData.quadBuffer.clear();
 	mData.lineVtxCount = 0;
 	mData.lineBufferPtr = mData.lineBuffer.data();
 	//mData.lineBuffer.clear();
 	mData.texUnitIdx = 1;
+	++mData.texBatch;
 }
 
 /*  _________________________________________________________________________ */
 /*! NextBatch
 
+@param reason
+Why the batch is drawn before the end of the scene, counted in the stats.
+
 @return none.
 
 This function moves to the next batch by first flushing the current batch and then
-beginning a new one. It also provides debug information about the renderer's statistics.
+beginning a new one.
 */
-void Renderer::NextBatch() {
+void Renderer::NextBatch(FlushReason reason) {
+	++mData.stats.flushes[static_cast<size_t>(reason)];
 	FlushBatch();
 	BeginBatch();
-
-	//auto stats = GetStats();
-	//std::cout << "Renderer Stats:\n"
-	//	<< "Draw Calls: " << stats.drawCalls
-	//	<< "\nQuads: " << stats.quadCount
-	//	<< "\nVertices: " << stats.GetTotalVtxCount()
-	//	<< "\nIndices: " << stats.GetTotalIdxCount();
-	//ResetStats();
 }
 
 //OpenGL Commands
@@ -610,15 +1296,45 @@ A shared pointer to the VertexArray object.
 The number of indices to draw. If not provided, the function will use the count 
 from the element buffer of the VertexArray.
 
+@param baseVtx (optional)
+Added to every index, used to draw a batch from its segment of the mapped ring.
+
 @return none.
 
 This function binds the provided VertexArray and then issues a draw call to OpenGL
 to draw the indexed geometry.
 */
-void Renderer::DrawIndexed(std::shared_ptr<VertexArray> const& vao, unsigned int idxCount) {
+void Renderer::DrawIndexed(std::shared_ptr<VertexArray> const& vao, unsigned int idxCount, int baseVtx) {
 	vao->Bind();
 	unsigned int count = idxCount ? idxCount : vao->GetElementBuffer()->GetCount();
-	glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+	if (baseVtx)
+		glDrawElementsBaseVertex(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, baseVtx);
+	else
+		glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+}
+
+/*  _________________________________________________________________________ */
+/*! DrawIndexedInstanced
+
+@param vao
+A shared pointer to the VertexArray object, its per instance attributes
+advancing once per instance.
+
+@param instanceCount
+The number of instances to draw.
+
+@param baseInstance (optional)
+The first instance to read from the per instance buffers.
+
+@return none.
+
+This function binds the provided VertexArray and draws all of its indices
+once for every instance.
+*/
+void Renderer::DrawIndexedInstanced(std::shared_ptr<VertexArray> const& vao, unsigned int instanceCount, unsigned int baseInstance) {
+	vao->Bind();
+	glDrawElementsInstancedBaseInstance(GL_TRIANGLES, vao->GetElementBuffer()->GetCount(), GL_UNSIGNED_INT,
+		nullptr, instanceCount, baseInstance);
 }
 
 /*  _________________________________________________________________________ */
@@ -648,7 +1364,25 @@ void Renderer::DrawLineArray(std::shared_ptr<VertexArray> const& vao, unsigned i
 This function resets the renderer's statistics to zero.
 */
 void Renderer::ResetStats() {
-	memset(&mData.stats, 0, sizeof(Statistics));
+	mData.stats = Statistics{};
+}
+
+/*  _________________________________________________________________________ */
+/*! AddCullCounts
+
+@param visible
+Number of sprites that passed the view test.
+
+@param culled
+Number of sprites that were skipped.
+
+@return none.
+
+Adds the result of culling a render queue to the statistics.
+*/
+void Renderer::AddCullCounts(unsigned int visible, unsigned int culled) {
+	mData.stats.visibleCount += visible;
+	mData.stats.culledCount += culled;
 }
 
 /*  _________________________________________________________________________ */
@@ -21,6 +21,7 @@
 
 #include "../include/pch.hpp"
 #include "Graphics/SubTexture.hpp"
+#include "Graphics/TextureAtlas.hpp"
 
 /*  _________________________________________________________________________ */
 /*! SubTexture
@@ -52,7 +53,7 @@ Shared pointer to the parent texture.
 
 This function returns a shared pointer to the parent texture of the sub-texture.
 */
-std::shared_ptr<Texture> const SubTexture::GetTexture() const {
+std::shared_ptr<Texture> const& SubTexture::GetTexture() const {
 	return mTex;
 }
 
@@ -91,4 +92,24 @@ std::shared_ptr<SubTexture> SubTexture::Create(std::shared_ptr<Texture> const& t
 	glm::vec2 max{ ((idxCoord.x + 1) * size.x) / tex->GetWidth(), ((idxCoord.y + 1) * size.y) / tex->GetHeight() };
 	std::shared_ptr<SubTexture> subtex { std::make_shared<SubTexture>(tex, min, max) };
 	return subtex;
+}
+
+/*  _________________________________________________________________________ */
+/*! Create
+
+@param path
+Path of the sheet the sprite is listed under in the atlas list.
+
+@param id
+Id of the sprite in the sheet.
+
+@return
+Shared pointer to the created SubTexture.
+
+This static function creates a SubTexture over the region of the atlas
+page the sprite was packed on. TextureAtlas::Init has to have run.
+*/
+std::shared_ptr<SubTexture> SubTexture::Create(std::string const& path, unsigned int id) {
+	TextureAtlas::Region const& region{ TextureAtlas::GetInstance()->GetRegion(path, id) };
+	return std::make_shared<SubTexture>(region.texture, region.min, region.max);
 }
\ No newline at end of file
@@ -0,0 +1,187 @@
+/******************************************************************************/
+/*!
+\par        Image Engine
+\file       TextureAtlas.cpp
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief		packs the sprites listed in data/assets.json into a few atlas
+			textures at startup
+
+			a sprite is a cell of its sheet, width by height pixels at
+			cell u, v, the same cells SubTexture::Create cuts. sprites
+			are packed tallest first, a page is opened when none of the
+			open ones has room, and every page is trimmed to what was
+			packed into it before it is uploaded.
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+			or disclosure of this file or its contents without the prior
+			written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+#include "../include/pch.hpp"
+#include "Graphics/TextureAtlas.hpp"
+#include "Math/SkylinePacker.hpp"
+#include <Core/Serialization/SerializationManager.hpp>
+
+std::shared_ptr<TextureAtlas> TextureAtlas::_mSelf = nullptr;
+
+namespace {
+	struct SheetImage {
+		std::string path;
+		unsigned int width;
+		unsigned int height;
+		std::unique_ptr<unsigned char, void (*)(void*)> pixels;
+	};
+
+	struct AtlasSprite {
+		size_t sheet;
+		unsigned int id;
+		unsigned int x, y, w, h; //the cell in its sheet
+		size_t page;
+		Image::PackRect rect; //on the page, padding included
+	};
+
+	/*  _________________________________________________________________________ */
+	/*! CopySprite
+
+	@param sheet
+	The sheet the sprite is cut from.
+
+	@param sprite
+	The sprite, already packed.
+
+	@param page
+	The pixels of the page it was packed on.
+
+	@param pageWidth
+	The width of the page.
+
+	@return none.
+
+	Copies the cell into its rect and repeats the edge pixels of the cell
+	into the padding around it.
+	*/
+	void CopySprite(SheetImage const& sheet, AtlasSprite const& sprite, std::vector<unsigned char>& page, unsigned int pageWidth) {
+		unsigned int constexpr pad{ TextureAtlas::cPadding };
+		for (unsigned int row{}; row < sprite.rect.h; ++row) {
+			unsigned int cellRow{ row < pad ? 0 : std::min(row - pad, sprite.h - 1) };
+			unsigned char const* src{ sheet.pixels.get() + (static_cast<size_t>(sprite.y + cellRow) * sheet.width + sprite.x) * 4 };
+			unsigned char* dst{ page.data() + (static_cast<size_t>(sprite.rect.y + row) * pageWidth + sprite.rect.x) * 4 };
+			std::memcpy(dst + pad * 4, src, static_cast<size_t>(sprite.w) * 4);
+			for (unsigned int i{}; i < pad; ++i) {
+				std::memcpy(dst + i * 4, src, 4);
+				std::memcpy(dst + (pad + sprite.w + i) * 4, src + (sprite.w - 1) * 4, 4);
+			}
+		}
+	}
+}
+
+/*  _________________________________________________________________________ */
+/*! Init
+
+@param name
+The json in Data/ listing the sheets and their sprites.
+
+@return none.
+
+Loads every sheet, packs its sprites and uploads the pages. Replaces any
+atlas built before. Throws if a sheet cannot be loaded, a sprite is not
+inside its sheet or a sprite does not fit on a page.
+*/
+void TextureAtlas::Init(std::string const& name) {
+	std::shared_ptr<Serializer::SerializationManager> sm{ Serializer::SerializationManager::GetInstance() };
+	if (!sm->OpenJSON(name)) throw std::runtime_error("Failed to open atlas list: " + name);
+	mPages.clear();
+	mRegions.clear();
+
+	GLint maxSize{};
+	glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
+	unsigned int pageSize{ maxSize > 0 ? std::min(cMaxPageSize, static_cast<unsigned int>(maxSize)) : cMaxPageSize };
+
+	std::vector<SheetImage> sheets;
+	std::vector<AtlasSprite> sprites;
+	for (auto const& sheet : sm->At(name, "spritesheet").GetArray()) {
+		std::string path{ sheet["path"].GetString() };
+		int width, height, channels;
+		stbi_set_flip_vertically_on_load(true);
+		unsigned char* data{ stbi_load(path.c_str(), &width, &height, &channels, STBI_rgb_alpha) };
+		stbi_set_flip_vertically_on_load(false);
+		if (!data) throw std::runtime_error("Failed to load texture: " + path);
+		sheets.push_back(SheetImage{ path, static_cast<unsigned int>(width), static_cast<unsigned int>(height), { data, stbi_image_free } });
+
+		for (auto const& cell : sheet["sprite"].GetArray()) {
+			AtlasSprite sprite{};
+			sprite.sheet = sheets.size() - 1;
+			sprite.id = cell["id"].GetUint();
+			sprite.w = cell["width"].GetUint();
+			sprite.h = cell["height"].GetUint();
+			sprite.x = cell["u"].GetUint() * sprite.w;
+			sprite.y = cell["v"].GetUint() * sprite.h;
+			if (!sprite.w || !sprite.h || sprite.x + sprite.w > sheets.back().width || sprite.y + sprite.h > sheets.back().height) {
+				throw std::runtime_error("Sprite " + std::to_string(sprite.id) + " is outside its sheet: " + path);
+			}
+			sprites.push_back(sprite);
+		}
+	}
+
+	//tallest first, so each row of the skyline is filled by similar heights
+	std::sort(sprites.begin(), sprites.end(), [](AtlasSprite const& lhs, AtlasSprite const& rhs) {
+		return lhs.h != rhs.h ? lhs.h > rhs.h : lhs.w > rhs.w;
+	});
+
+	std::vector<Image::SkylinePacker> packers;
+	for (auto& sprite : sprites) {
+		unsigned int w{ sprite.w + cPadding * 2 }, h{ sprite.h + cPadding * 2 };
+		if (w > pageSize || h > pageSize) {
+			throw std::runtime_error("Sprite " + std::to_string(sprite.id) + " is larger than an atlas page: " + sheets[sprite.sheet].path);
+		}
+		sprite.page = 0;
+		while (sprite.page < packers.size() && !packers[sprite.page].Insert(w, h, sprite.rect)) ++sprite.page;
+		if (sprite.page == packers.size()) {
+			packers.emplace_back(pageSize, pageSize);
+			packers.back().Insert(w, h, sprite.rect);
+		}
+	}
+
+	std::vector<std::vector<unsigned char>> pixels(packers.size());
+	for (size_t i{}; i < packers.size(); ++i) {
+		pixels[i].assign(static_cast<size_t>(packers[i].GetUsedWidth()) * packers[i].GetUsedHeight() * 4, 0);
+	}
+	for (auto const& sprite : sprites) {
+		CopySprite(sheets[sprite.sheet], sprite, pixels[sprite.page], packers[sprite.page].GetUsedWidth());
+	}
+	for (size_t i{}; i < packers.size(); ++i) {
+		mPages.push_back(std::make_shared<Texture>(packers[i].GetUsedWidth(), packers[i].GetUsedHeight()));
+		mPages.back()->SetData(pixels[i].data());
+	}
+
+	for (auto const& sprite : sprites) {
+		std::vector<Region>& regions{ mRegions[sheets[sprite.sheet].path] };
+		if (regions.size() <= sprite.id) regions.resize(sprite.id + 1);
+		glm::vec2 pageSizes{ static_cast<float>(mPages[sprite.page]->GetWidth()), static_cast<float>(mPages[sprite.page]->GetHeight()) };
+		glm::vec2 min{ static_cast<float>(sprite.rect.x + cPadding), static_cast<float>(sprite.rect.y + cPadding) };
+		regions[sprite.id] = Region{ mPages[sprite.page], min / pageSizes, (min + glm::vec2{ sprite.w, sprite.h }) / pageSizes };
+	}
+}
+
+/*  _________________________________________________________________________ */
+/*! GetRegion
+
+@param path
+The path of the sheet, as written in the atlas list.
+
+@param id
+The id of the sprite in the sheet.
+
+@return
+The page and uvs of the sprite. Throws if it was not packed.
+*/
+TextureAtlas::Region const& TextureAtlas::GetRegion(std::string const& path, unsigned int id) const {
+	auto sheet{ mRegions.find(path) };
+	if (sheet == mRegions.end() || id >= sheet->second.size() || !sheet->second[id].texture) {
+		throw std::runtime_error("Sprite " + std::to_string(id) + " is not in the atlas: " + path);
+	}
+	return sheet->second[id];
+}
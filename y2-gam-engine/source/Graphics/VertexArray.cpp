@@ -38,6 +38,8 @@ static GLenum AttributeToGLType(AttributeType type) {
 		return GL_INT;
 	case AttributeType::BOOL:
 		return GL_BOOL;
+	case AttributeType::UBYTE4:
+		return GL_UNSIGNED_BYTE;
 	}
 
 	std::cout << "Unknown AttributeType!\n";
@@ -99,13 +101,18 @@ void VertexArray::Unbind() const {
 @param vbo
 A shared pointer to the VertexBuffer object to be added to the VAO.
 
+@param isPerInstance (optional)
+Advance the attributes of this vbo once per instance instead of once per
+vertex. Default is false.
+
 This function binds the VAO and the provided VertexBuffer, sets up the vertex attributes
 according to the layout of the VertexBuffer, and adds the VertexBuffer to the list of VBOs.
+The attribute locations carry on from the vbos added before it.
 */
-void VertexArray::AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vbo) {
+void VertexArray::AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vbo, bool isPerInstance) {
 	glBindVertexArray(vaoHdl);
 	vbo->Bind();
-	unsigned int attrib_idx{};
+	unsigned int attrib_idx{ mAttribCount };
 	const auto& layout{ vbo->GetLayout() };
 	for (auto const& elem : layout) {
 		glEnableVertexAttribArray(attrib_idx);
@@ -116,8 +123,11 @@ void VertexArray::AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vbo) {
 			vbo->GetLayout().GetStride(),
 			reinterpret_cast<const void*>(
 				static_cast<uintptr_t>(elem.offset)));
+		if (isPerInstance)
+			glVertexAttribDivisor(attrib_idx, 1);
 		++attrib_idx;
 	}
+	mAttribCount = attrib_idx;
 	mVbos.push_back(vbo);
 }
 
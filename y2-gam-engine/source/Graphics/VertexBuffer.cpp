@@ -27,14 +27,26 @@
 @param size
 The size of the vertex buffer.
 
+@param isPersistentMapped
+Whether to map the buffer for its whole lifetime.
+
 This constructor initializes the VertexBuffer with the provided size and sets
-the buffer data storage with dynamic draw usage.
+the buffer data storage with dynamic draw usage. A persistent mapped buffer
+gets immutable storage instead and stays mapped (coherently) until it is
+destroyed, so the cpu can write vertices into it directly. The caller must
+fence what the gpu may still be reading before writing over it.
 */
-VertexBuffer::VertexBuffer(unsigned int size) {
+VertexBuffer::VertexBuffer(unsigned int size, bool isPersistentMapped) {
 	glCreateBuffers(1, &mVboHdl);
 	VertexBuffer::Bind();
-	glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
-
+	if (!isPersistentMapped) {
+		glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+		return;
+	}
+
+	constexpr GLbitfield flags{ GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT };
+	glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+	mMappedData = glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
 }
 
 /*  _________________________________________________________________________ */
@@ -62,6 +74,10 @@ VertexBuffer::VertexBuffer(float* vertices, unsigned int size) {
 Destructor for the VertexBuffer class. Cleans up the VBO resources.
 */
 VertexBuffer::~VertexBuffer() {
+	if (mMappedData) {
+		glBindBuffer(GL_ARRAY_BUFFER, mVboHdl);
+		glUnmapBuffer(GL_ARRAY_BUFFER);
+	}
 	glDeleteBuffers(1, &mVboHdl);
 }
 
@@ -99,6 +115,25 @@ std::shared_ptr<VertexBuffer> VertexBuffer::Create(float* vertices, unsigned int
 	return std::make_shared<VertexBuffer>(vertices, size);
 }
 
+/*  _________________________________________________________________________ */
+/*! CreateMapped
+
+@param size
+The size of the vertex buffer.
+
+@return
+A shared pointer to the created VertexBuffer, or nullptr if the context has
+no buffer storage (GL 4.4) or the buffer could not be mapped.
+
+This static function creates a persistently mapped VertexBuffer with the
+provided size.
+*/
+std::shared_ptr<VertexBuffer> VertexBuffer::CreateMapped(unsigned int size) {
+	if (!GLAD_GL_VERSION_4_4) return nullptr;
+	std::shared_ptr<VertexBuffer> vbo{ std::make_shared<VertexBuffer>(size, true) };
+	return vbo->GetMappedData() ? vbo : nullptr;
+}
+
 /*  _________________________________________________________________________ */
 /*! Bind
 
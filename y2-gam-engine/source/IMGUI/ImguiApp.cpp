@@ -218,6 +218,7 @@ namespace Image {
                 ImGui::Separator();
                 ImGui::Text("Color");
                 ImGui::ColorPicker4("Color Picker", &sprite.color.r);
+                ImGui::Checkbox("Static", &sprite.isStatic);
             }
             if (gCoordinator->HasComponent<RigidBody>(gSelectedEntity)) {
                 RigidBody& rigidBody = gCoordinator->GetComponent<RigidBody>(gSelectedEntity);
@@ -427,13 +428,27 @@ namespace Image {
 
     @return none.
 
-     This function displays the game engine's framebuffer.
+     This function displays the game engine's framebuffer, with the renderer
+     stats of the last frame under it.
     */
     void BufferWindow() {
         ImGui::Begin("Image Game Engine");
 
         unsigned int texHdl = ::gCoordinator->GetSystem<RenderSystem>()->GetFramebuffer()->GetColorAttachmentID();
         ImGui::Image(reinterpret_cast<void*>(static_cast<uintptr_t>(texHdl)), ImVec2(ENGINE_SCREEN_WIDTH / 1.5f, ENGINE_SCREEN_HEIGHT / 1.5f), ImVec2{ 0, 1 }, ImVec2{ 1, 0 });
+
+        if (ImGui::CollapsingHeader("Renderer Stats")) {
+            Statistics stats{ Renderer::GetStats() };
+            ImGui::Text("Draw Calls: %u", stats.drawCalls);
+            ImGui::Text("Quads: %u, Lines: %u", stats.quadCount, stats.lineCount);
+            ImGui::Text("Sprites Visible: %u, Culled: %u", stats.visibleCount, stats.culledCount);
+            ImGui::Text("Flushes: %u batch full, %u texture units, %u lines, %u before instancing, %u scene end",
+                stats.GetFlushCount(FlushReason::INDICES), stats.GetFlushCount(FlushReason::TEXTURE_UNITS),
+                stats.GetFlushCount(FlushReason::LINES), stats.GetFlushCount(FlushReason::INSTANCED),
+                stats.GetFlushCount(FlushReason::SCENE_END));
+            ImGui::Text("Uploaded: %.1f KB", static_cast<double>(stats.uploadBytes) / 1024.0);
+            ImGui::Text("Vertex Generation: %.3f ms, Submit: %.3f ms", stats.vtxGenMs, stats.submitMs);
+        }
         ImGui::End();
     }
 
@@ -8,11 +8,13 @@
 #include "Components/Transform.hpp"
 #include "Components/Editor.hpp"
 #include "Components/Animation.hpp"
+#include "Components/Joint.hpp"
 #include "Core/Serialization/SerializerComponent.hpp"
 #include "Core/Coordinator.hpp"
 #include "Systems/EntitySerializationSystem.hpp"
 #include "Systems/EditorControlSystem.hpp"
 #include "Systems/PhysicsSystem.hpp"
+#include "Systems/JointSystem.hpp"
 #include "Systems/InputSystem.hpp"
 #include "Systems/CollisionSystem.hpp"
 #include "Systems/RenderSystem.hpp"
@@ -28,12 +30,14 @@
 
 #include "Audio/Sound.hpp"
 #include "Graphics/FontRenderer.hpp"
+#include "Graphics/TextureAtlas.hpp"
 #include "Scripting/ScriptManager.hpp"
 
 
 #include "Logging/LoggingSystem.hpp"
 #include "Logging/backward.hpp"
 #include "Engine/PrefabsManager.hpp"
+#include "Engine/Benchmark.hpp"
 
 
 namespace {
@@ -47,13 +51,16 @@ void QuitHandler([[maybe_unused]] Event& event)
 }
 std::shared_ptr<Globals::GlobalValContainer>  Globals::GlobalValContainer::_mSelf = 0;
 
-int main()
+int main(int argc, char* argv[])
 {
 	// Enable run-time memory check for debug builds.
 #if defined(DEBUG) | defined(_DEBUG)
 	_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
 #endif
 	Globals::GlobalValContainer::GetInstance()->ReadGlobalInts();
+	// headless benchmarks, skips window, audio and mono
+	int benchExitCode{};
+	if (Benchmark::Run(argc, argv, benchExitCode)) return benchExitCode;
 	// Mono Testing
 	Image::ScriptManager::Init();
 	MonoAssembly* ma{ Image::ScriptManager::LoadCSharpAssembly("../assets/scripts/y2-gam-script.dll") };
@@ -79,6 +86,7 @@ int main()
 	coordinator->RegisterComponent<RigidBody>();
 	coordinator->RegisterComponent<Transform>();
 	coordinator->RegisterComponent<Animation>();
+	coordinator->RegisterComponent<Joint>();
 	coordinator->RegisterComponent<OrthoCamera>();
 	coordinator->RegisterComponent<Script>();
 	coordinator->RegisterComponent<ImguiComponent>();
@@ -96,6 +104,16 @@ int main()
 
 	physicsSystem->Init();
 
+	auto jointSystem = coordinator->RegisterSystem<JointSystem>();
+	{
+		Signature signature;
+		signature.set(coordinator->GetComponentType<Joint>());
+		signature.set(coordinator->GetComponentType<RigidBody>());
+		coordinator->SetSystemSignature<JointSystem>(signature);
+	}
+
+	jointSystem->Init();
+
 	auto collisionSystem = coordinator->RegisterSystem<CollisionSystem>();
 	{
 		Signature signature;
@@ -105,6 +123,10 @@ int main()
 	}
 
 	collisionSystem->Init();
+	coordinator->AddEventListener(FUNCTION_LISTENER(Events::Physics::CONTACT_BEGIN, Image::ScriptManager::OnContactEvent));
+	coordinator->AddEventListener(FUNCTION_LISTENER(Events::Physics::CONTACT_END, Image::ScriptManager::OnContactEvent));
+	coordinator->AddEventListener(FUNCTION_LISTENER(Events::Physics::TRIGGER_BEGIN, Image::ScriptManager::OnContactEvent));
+	coordinator->AddEventListener(FUNCTION_LISTENER(Events::Physics::TRIGGER_END, Image::ScriptManager::OnContactEvent));
 
 	auto renderSystem = coordinator->RegisterSystem<RenderSystem>();
 	{
@@ -114,6 +136,8 @@ int main()
 		coordinator->SetSystemSignature<RenderSystem>(signature);
 	}
 
+	//the sprites of every sheet in data/assets.json, packed before anything cuts them
+	TextureAtlas::GetInstance()->Init("assets");
 	renderSystem->Init();
 
 	auto imguiSystem = coordinator->RegisterSystem<ImGuiSystem>();
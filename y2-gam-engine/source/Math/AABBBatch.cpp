@@ -0,0 +1,276 @@
+/******************************************************************************/
+/*!
+\par        Image Engine
+\file       AABBBatch.cpp
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief		batched aabb overlap kernel (scalar/sse/avx2) over soa blocks
+
+			tests one query box against a contiguous run of boxes and writes
+			one hit bit per box. the compares are strict, matching
+			CheckAABBDiscrete, so touching boxes do not overlap.
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+			or disclosure of this file or its contents without the prior
+			written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+#include "../../include/Math/AABBBatch.hpp"
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define IMAGE_AABB_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+//msvc allows avx2 intrinsics without /arch, gcc/clang need a per function target
+#if defined(IMAGE_AABB_X86) && !defined(_MSC_VER)
+#define IMAGE_AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define IMAGE_AVX2_TARGET
+#endif
+
+namespace {
+	/*  _________________________________________________________________________ */
+	/*! OverlapScalar
+
+	@param qmin Minimum corner of the query box.
+	@param qmax Maximum corner of the query box.
+	@param soa The boxes to test against.
+	@param first Index of the first box to test.
+	@param begin Offset (relative to first) of the first box this call tests.
+	@param count Offset (relative to first) one past the last box tested.
+	@param mask Hit bits, bit k set when box first+k overlaps.
+
+	@return The number of overlapping boxes.
+
+	Scalar path, also used for the tails of the simd paths.
+	*/
+	size_t OverlapScalar(Vec2 const& qmin, Vec2 const& qmax, Collision::AABBSoA const& soa,
+		size_t first, size_t begin, size_t count, uint32_t* mask) {
+		size_t hits{};
+		for (size_t k{ begin }; k < count; ++k) {
+			size_t i{ first + k };
+			bool overlap{ qmin.x < soa.maxX[i] && qmax.x > soa.minX[i] &&
+				qmin.y < soa.maxY[i] && qmax.y > soa.minY[i] };
+			if (overlap) {
+				mask[k >> 5] |= 1u << (k & 31);
+				++hits;
+			}
+		}
+		return hits;
+	}
+
+#ifdef IMAGE_AABB_X86
+	/*  _________________________________________________________________________ */
+	/*! OverlapSSE
+
+	@param qmin Minimum corner of the query box.
+	@param qmax Maximum corner of the query box.
+	@param soa The boxes to test against.
+	@param first Index of the first box to test.
+	@param count Number of boxes to test.
+	@param mask Hit bits, bit k set when box first+k overlaps.
+
+	@return The number of overlapping boxes.
+
+	Tests 4 boxes per iteration using sse compares and movemask.
+	*/
+	size_t OverlapSSE(Vec2 const& qmin, Vec2 const& qmax, Collision::AABBSoA const& soa,
+		size_t first, size_t count, uint32_t* mask) {
+		const __m128 qminX{ _mm_set1_ps(qmin.x) }, qminY{ _mm_set1_ps(qmin.y) };
+		const __m128 qmaxX{ _mm_set1_ps(qmax.x) }, qmaxY{ _mm_set1_ps(qmax.y) };
+		const float* minX{ soa.minX.data() + first };
+		const float* minY{ soa.minY.data() + first };
+		const float* maxX{ soa.maxX.data() + first };
+		const float* maxY{ soa.maxY.data() + first };
+
+		size_t hits{}, k{};
+		for (; k + 4 <= count; k += 4) {
+			__m128 ox{ _mm_and_ps(_mm_cmplt_ps(qminX, _mm_loadu_ps(maxX + k)),
+				_mm_cmpgt_ps(qmaxX, _mm_loadu_ps(minX + k))) };
+			__m128 oy{ _mm_and_ps(_mm_cmplt_ps(qminY, _mm_loadu_ps(maxY + k)),
+				_mm_cmpgt_ps(qmaxY, _mm_loadu_ps(minY + k))) };
+			uint32_t bits{ static_cast<uint32_t>(_mm_movemask_ps(_mm_and_ps(ox, oy))) };
+			if (bits) {
+				//k is a multiple of 4 so the 4 bits never straddle a word
+				mask[k >> 5] |= bits << (k & 31);
+				hits += static_cast<size_t>((bits & 1) + ((bits >> 1) & 1) + ((bits >> 2) & 1) + ((bits >> 3) & 1));
+			}
+		}
+		return hits + OverlapScalar(qmin, qmax, soa, first, k, count, mask);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! OverlapAVX2
+
+	@param qmin Minimum corner of the query box.
+	@param qmax Maximum corner of the query box.
+	@param soa The boxes to test against.
+	@param first Index of the first box to test.
+	@param count Number of boxes to test.
+	@param mask Hit bits, bit k set when box first+k overlaps.
+
+	@return The number of overlapping boxes.
+
+	Tests 8 boxes per iteration using avx compares and movemask.
+	*/
+	IMAGE_AVX2_TARGET
+	size_t OverlapAVX2(Vec2 const& qmin, Vec2 const& qmax, Collision::AABBSoA const& soa,
+		size_t first, size_t count, uint32_t* mask) {
+		const __m256 qminX{ _mm256_set1_ps(qmin.x) }, qminY{ _mm256_set1_ps(qmin.y) };
+		const __m256 qmaxX{ _mm256_set1_ps(qmax.x) }, qmaxY{ _mm256_set1_ps(qmax.y) };
+		const float* minX{ soa.minX.data() + first };
+		const float* minY{ soa.minY.data() + first };
+		const float* maxX{ soa.maxX.data() + first };
+		const float* maxY{ soa.maxY.data() + first };
+
+		size_t hits{}, k{};
+		for (; k + 8 <= count; k += 8) {
+			__m256 ox{ _mm256_and_ps(_mm256_cmp_ps(qminX, _mm256_loadu_ps(maxX + k), _CMP_LT_OQ),
+				_mm256_cmp_ps(qmaxX, _mm256_loadu_ps(minX + k), _CMP_GT_OQ)) };
+			__m256 oy{ _mm256_and_ps(_mm256_cmp_ps(qminY, _mm256_loadu_ps(maxY + k), _CMP_LT_OQ),
+				_mm256_cmp_ps(qmaxY, _mm256_loadu_ps(minY + k), _CMP_GT_OQ)) };
+			uint32_t bits{ static_cast<uint32_t>(_mm256_movemask_ps(_mm256_and_ps(ox, oy))) };
+			if (bits) {
+				//k is a multiple of 8 so the 8 bits never straddle a word
+				mask[k >> 5] |= bits << (k & 31);
+				for (uint32_t b{ bits }; b; b &= b - 1) ++hits;
+			}
+		}
+		return hits + OverlapScalar(qmin, qmax, soa, first, k, count, mask);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! CpuHasAVX2
+
+	@return true if the cpu and the os both support avx2.
+
+	Checks cpuid for avx2 and xgetbv for the os saving the ymm registers.
+	*/
+	bool CpuHasAVX2() {
+#if defined(_MSC_VER)
+		int info[4]{};
+		__cpuid(info, 1);
+		bool osxsave{ (info[2] & (1 << 27)) != 0 };
+		bool avx{ (info[2] & (1 << 28)) != 0 };
+		if (!osxsave || !avx) return false;
+		if ((_xgetbv(0) & 0x6) != 0x6) return false;
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+#else
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2");
+#endif
+	}
+#endif
+}
+
+namespace Collision {
+	/*  _________________________________________________________________________ */
+	/*! IsSimdIsaSupported
+
+	@param isa The instruction set to check.
+
+	@return true if the kernel can run with the given instruction set.
+	*/
+	bool IsSimdIsaSupported(SimdIsa isa) {
+		switch (isa) {
+		case SimdIsa::SCALAR: return true;
+#ifdef IMAGE_AABB_X86
+		//sse2 is baseline on every x64 target
+		case SimdIsa::SSE: return true;
+		case SimdIsa::AVX2: {
+			static const bool hasAVX2{ CpuHasAVX2() };
+			return hasAVX2;
+		}
+#endif
+		default: return false;
+		}
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! GetBestSimdIsa
+
+	@return The widest instruction set supported by this machine.
+
+	Resolved once and cached.
+	*/
+	SimdIsa GetBestSimdIsa() {
+		static const SimdIsa best{
+			IsSimdIsaSupported(SimdIsa::AVX2) ? SimdIsa::AVX2 :
+			IsSimdIsaSupported(SimdIsa::SSE) ? SimdIsa::SSE : SimdIsa::SCALAR };
+		return best;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! GetSimdIsaName
+
+	@param isa The instruction set.
+
+	@return A printable name for the instruction set.
+	*/
+	const char* GetSimdIsaName(SimdIsa isa) {
+		switch (isa) {
+		case SimdIsa::SSE: return "SSE";
+		case SimdIsa::AVX2: return "AVX2";
+		default: return "Scalar";
+		}
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! OverlapBatch
+
+	@param isa The instruction set to run the kernel with.
+	@param qmin Minimum corner of the query box.
+	@param qmax Maximum corner of the query box.
+	@param soa The boxes to test against.
+	@param first Index of the first box to test.
+	@param count Number of boxes to test.
+	@param mask Output hit bits, needs AABBMaskWords(count) words. bit k is set
+	when box first+k overlaps the query.
+
+	@return The number of overlapping boxes.
+
+	Tests the query against soa[first, first+count). The mask is cleared first.
+	An unsupported isa falls back to the best supported one.
+	*/
+	size_t OverlapBatch(SimdIsa isa, Vec2 const& qmin, Vec2 const& qmax, AABBSoA const& soa,
+		size_t first, size_t count, uint32_t* mask) {
+		std::memset(mask, 0, AABBMaskWords(count) * sizeof(uint32_t));
+		if (!count) return 0;
+		if (!IsSimdIsaSupported(isa)) isa = GetBestSimdIsa();
+
+		switch (isa) {
+#ifdef IMAGE_AABB_X86
+		case SimdIsa::AVX2: return OverlapAVX2(qmin, qmax, soa, first, count, mask);
+		case SimdIsa::SSE: return OverlapSSE(qmin, qmax, soa, first, count, mask);
+#endif
+		default: return OverlapScalar(qmin, qmax, soa, first, 0, count, mask);
+		}
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! OverlapBatch
+
+	@param qmin Minimum corner of the query box.
+	@param qmax Maximum corner of the query box.
+	@param soa The boxes to test against.
+	@param first Index of the first box to test.
+	@param count Number of boxes to test.
+	@param mask Output hit bits, needs AABBMaskWords(count) words.
+
+	@return The number of overlapping boxes.
+
+	Runtime dispatched version using the best instruction set available.
+	*/
+	size_t OverlapBatch(Vec2 const& qmin, Vec2 const& qmax, AABBSoA const& soa,
+		size_t first, size_t count, uint32_t* mask) {
+		return OverlapBatch(GetBestSimdIsa(), qmin, qmax, soa, first, count, mask);
+	}
+}
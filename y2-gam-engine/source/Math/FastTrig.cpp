@@ -0,0 +1,89 @@
+/******************************************************************************/
+/*!
+\par        Image Engine
+\file       FastTrig.cpp
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief		batched polynomial sin/cos, 4 lanes at a time with sse
+
+			the lanes follow SinCos step for step, the quadrant swap and
+			sign flips are done with masks instead of branches. a group
+			with an angle too large for the reduction falls back to the
+			scalar path.
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+			or disclosure of this file or its contents without the prior
+			written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+#include "../../include/Math/FastTrig.hpp"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define IMAGE_TRIG_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace Image {
+	/*  _________________________________________________________________________ */
+	/*! SinCosBatch
+
+	@param angles The angles in radians.
+	@param sines Set to the sines of the angles.
+	@param cosines Set to the cosines of the angles.
+	@param count The number of angles.
+
+	@return none.
+
+	Computes the sine and cosine of every angle, same results as calling
+	SinCos on each of them.
+	*/
+	void SinCosBatch(float const* angles, float* sines, float* cosines, size_t count) {
+		size_t i{};
+#ifdef IMAGE_TRIG_SSE
+		using namespace FastTrig;
+		__m128 const signMask{ _mm_set1_ps(-0.f) };
+		__m128 const maxAngle{ _mm_set1_ps(MAX_ANGLE) };
+		__m128 const magic{ _mm_set1_ps(ROUND_MAGIC) };
+		__m128i const one{ _mm_set1_epi32(1) };
+		__m128i const two{ _mm_set1_epi32(2) };
+		for (; i + 4 <= count; i += 4) {
+			__m128 angle{ _mm_loadu_ps(angles + i) };
+			//also catches nan, which fails the compare
+			if (_mm_movemask_ps(_mm_cmple_ps(_mm_andnot_ps(signMask, angle), maxAngle)) != 0xF) {
+				for (size_t k{ i }; k < i + 4; ++k) SinCos(angles[k], sines[k], cosines[k]);
+				continue;
+			}
+			__m128 j{ _mm_add_ps(_mm_mul_ps(angle, _mm_set1_ps(TWO_OVER_PI)), magic) };
+			j = _mm_sub_ps(j, magic);
+			__m128i quadrant{ _mm_cvtps_epi32(j) };
+			__m128 r{ _mm_sub_ps(angle, _mm_mul_ps(j, _mm_set1_ps(PIO2_1))) };
+			r = _mm_sub_ps(r, _mm_mul_ps(j, _mm_set1_ps(PIO2_2)));
+			r = _mm_sub_ps(r, _mm_mul_ps(j, _mm_set1_ps(PIO2_3)));
+
+			__m128 z{ _mm_mul_ps(r, r) };
+			__m128 s{ _mm_add_ps(_mm_mul_ps(_mm_set1_ps(SIN_3), z), _mm_set1_ps(SIN_2)) };
+			s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(SIN_1));
+			s = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(s, z), r), r);
+			__m128 c{ _mm_add_ps(_mm_mul_ps(_mm_set1_ps(COS_3), z), _mm_set1_ps(COS_2)) };
+			c = _mm_add_ps(_mm_mul_ps(c, z), _mm_set1_ps(COS_1));
+			c = _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(c, z), z), _mm_mul_ps(_mm_set1_ps(0.5f), z));
+			c = _mm_add_ps(c, _mm_set1_ps(1.f));
+
+			//odd quadrants swap sin and cos
+			__m128 swap{ _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, one), one)) };
+			__m128 sine{ _mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s)) };
+			__m128 cosine{ _mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c)) };
+			//bit 1 of the quadrant moved up to the sign bit
+			__m128 sineSign{ _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, two), 30)) };
+			__m128 cosineSign{ _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, one), two), 30)) };
+			_mm_storeu_ps(sines + i, _mm_xor_ps(sine, sineSign));
+			_mm_storeu_ps(cosines + i, _mm_xor_ps(cosine, cosineSign));
+		}
+#endif
+		for (; i < count; ++i) {
+			SinCos(angles[i], sines[i], cosines[i]);
+		}
+	}
+}
@@ -0,0 +1,575 @@
+/******************************************************************************/
+/*!
+\par        Image Engine
+\file       Narrowphase.cpp
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief		contact kernels for the non box collider shapes
+
+			circles and boxes have their own cheap kernels. capsules and
+			polygons are treated as a convex core grown by a radius and go
+			through one separating axis + clipping kernel, the same scheme
+			as the box kernel so the feature pairs still warm start.
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+			or disclosure of this file or its contents without the prior
+			written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+#include "../../include/Math/Narrowphase.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define IMAGE_NARROWPHASE_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+	using namespace Physics;
+
+	//same bias towards the first body as the box kernel
+	constexpr float RELATIVE_TOL{ 0.95f };
+	constexpr float ABSOLUTE_TOL{ 0.01f };
+	constexpr float EPSILON{ 1e-6f };
+
+	/*  _________________________________________________________________________ */
+	/*! Rotate
+
+	@param v The vector.
+	@param c Cosine of the angle.
+	@param s Sine of the angle.
+
+	@return The rotated vector.
+	*/
+	inline Vec2 Rotate(Vec2 const& v, float c, float s) {
+		return Vec2{ c * v.x - s * v.y, s * v.x + c * v.y };
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! EdgeFeature
+
+	@param edge Index of the edge.
+
+	@return The edge as a feature number, 0 is reserved for NO_EDGE.
+	*/
+	inline EdgeNumbers EdgeFeature(uint32_t edge) {
+		return static_cast<EdgeNumbers>(edge + 1);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! ClosestPointOnSegment
+
+	@param p The point.
+	@param a Start of the segment.
+	@param b End of the segment.
+
+	@return The point on ab closest to p.
+	*/
+	Vec2 ClosestPointOnSegment(Vec2 const& p, Vec2 const& a, Vec2 const& b) {
+		Vec2 ab{ b - a };
+		float lenSq{ dot(ab, ab) };
+		if (lenSq < EPSILON) return a;
+		float t{ std::clamp(dot(p - a, ab) / lenSq, 0.f, 1.f) };
+		return a + ab * t;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! ClosestPointsSegments
+
+	@param p1 Start of the first segment.
+	@param q1 End of the first segment.
+	@param p2 Start of the second segment.
+	@param q2 End of the second segment.
+	@param c1 Closest point on the first segment.
+	@param c2 Closest point on the second segment.
+
+	@return none.
+
+	Closest points between two segments, from real time collision detection.
+	*/
+	void ClosestPointsSegments(Vec2 const& p1, Vec2 const& q1, Vec2 const& p2, Vec2 const& q2,
+		Vec2& c1, Vec2& c2) {
+		Vec2 d1{ q1 - p1 }, d2{ q2 - p2 }, r{ p1 - p2 };
+		float a{ dot(d1, d1) }, e{ dot(d2, d2) }, f{ dot(d2, r) };
+		float s{}, t{};
+		if (a < EPSILON && e < EPSILON) {
+			c1 = p1; c2 = p2;
+			return;
+		}
+		if (a < EPSILON) {
+			t = std::clamp(f / e, 0.f, 1.f);
+		}
+		else {
+			float c{ dot(d1, r) };
+			if (e < EPSILON) {
+				s = std::clamp(-c / a, 0.f, 1.f);
+			}
+			else {
+				float b{ dot(d1, d2) };
+				float denom{ a * e - b * b };
+				s = denom != 0.f ? std::clamp((b * f - c * e) / denom, 0.f, 1.f) : 0.f;
+				t = (b * s + f) / e;
+				if (t < 0.f) {
+					t = 0.f;
+					s = std::clamp(-c / a, 0.f, 1.f);
+				}
+				else if (t > 1.f) {
+					t = 1.f;
+					s = std::clamp((b - c) / a, 0.f, 1.f);
+				}
+			}
+		}
+		c1 = p1 + d1 * s;
+		c2 = p2 + d2 * t;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! FindMaxSeparation
+
+	@param edge Output, the edge of a with the largest separation.
+	@param a The hull whose edge normals are tested.
+	@param b The other hull.
+
+	@return The largest separation of b along an edge normal of a, negative
+	when the cores overlap on every axis of a.
+	*/
+	float FindMaxSeparation(uint32_t& edge, Collision::Hull const& a, Collision::Hull const& b) {
+		float maxSeparation{ -FLOAT_MAX };
+		edge = 0;
+		for (uint32_t i{}; i < a.count; ++i) {
+			float minDot{ FLOAT_MAX };
+			for (uint32_t j{}; j < b.count; ++j) {
+				minDot = std::min(minDot, dot(a.normals[i], b.vertices[j] - a.vertices[i]));
+			}
+			if (minDot > maxSeparation) {
+				maxSeparation = minDot;
+				edge = i;
+			}
+		}
+		return maxSeparation;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! BoxFaceTestScalar
+
+	@param soa The box pairs.
+	@param begin Index of the first pair to test.
+	@param mask Hit bits, bit k set when pair k may touch.
+
+	@return The number of pairs that may touch.
+
+	Scalar path, also used for the tail of the sse path.
+	*/
+	size_t BoxFaceTestScalar(Collision::BoxPairSoA const& soa, size_t begin, uint32_t* mask) {
+		size_t hits{};
+		for (size_t k{ begin }; k < soa.Size(); ++k) {
+			float d1x{ soa.c1[k] * soa.dx[k] + soa.s1[k] * soa.dy[k] };
+			float d1y{ -soa.s1[k] * soa.dx[k] + soa.c1[k] * soa.dy[k] };
+			float d2x{ soa.c2[k] * soa.dx[k] + soa.s2[k] * soa.dy[k] };
+			float d2y{ -soa.s2[k] * soa.dx[k] + soa.c2[k] * soa.dy[k] };
+			//|rot1T * rot2|, cos and sin of the relative angle
+			float cd{ fabs(soa.c1[k] * soa.c2[k] + soa.s1[k] * soa.s2[k]) };
+			float sd{ fabs(soa.c1[k] * soa.s2[k] - soa.s1[k] * soa.c2[k]) };
+
+			float face1x{ fabs(d1x) - soa.h1x[k] - (cd * soa.h2x[k] + sd * soa.h2y[k]) };
+			float face1y{ fabs(d1y) - soa.h1y[k] - (sd * soa.h2x[k] + cd * soa.h2y[k]) };
+			float face2x{ fabs(d2x) - soa.h2x[k] - (cd * soa.h1x[k] + sd * soa.h1y[k]) };
+			float face2y{ fabs(d2y) - soa.h2y[k] - (sd * soa.h1x[k] + cd * soa.h1y[k]) };
+			if (face1x > 0.f || face1y > 0.f || face2x > 0.f || face2y > 0.f) continue;
+
+			mask[k >> 5] |= 1u << (k & 31);
+			++hits;
+		}
+		return hits;
+	}
+
+#ifdef IMAGE_NARROWPHASE_SSE
+	/*  _________________________________________________________________________ */
+	/*! BoxFaceTestSSE
+
+	@param soa The box pairs.
+	@param mask Hit bits, bit k set when pair k may touch.
+
+	@return The number of pairs that may touch.
+
+	Same face test as the scalar path, 4 pairs per iteration.
+	*/
+	size_t BoxFaceTestSSE(Collision::BoxPairSoA const& soa, uint32_t* mask) {
+		const __m128 signMask{ _mm_set1_ps(-0.f) };
+		const __m128 zero{ _mm_setzero_ps() };
+		auto abs = [&signMask](__m128 v) { return _mm_andnot_ps(signMask, v); };
+
+		size_t hits{}, k{};
+		for (; k + 4 <= soa.Size(); k += 4) {
+			__m128 dx{ _mm_loadu_ps(soa.dx.data() + k) }, dy{ _mm_loadu_ps(soa.dy.data() + k) };
+			__m128 c1{ _mm_loadu_ps(soa.c1.data() + k) }, s1{ _mm_loadu_ps(soa.s1.data() + k) };
+			__m128 c2{ _mm_loadu_ps(soa.c2.data() + k) }, s2{ _mm_loadu_ps(soa.s2.data() + k) };
+			__m128 h1x{ _mm_loadu_ps(soa.h1x.data() + k) }, h1y{ _mm_loadu_ps(soa.h1y.data() + k) };
+			__m128 h2x{ _mm_loadu_ps(soa.h2x.data() + k) }, h2y{ _mm_loadu_ps(soa.h2y.data() + k) };
+
+			__m128 d1x{ _mm_add_ps(_mm_mul_ps(c1, dx), _mm_mul_ps(s1, dy)) };
+			__m128 d1y{ _mm_sub_ps(_mm_mul_ps(c1, dy), _mm_mul_ps(s1, dx)) };
+			__m128 d2x{ _mm_add_ps(_mm_mul_ps(c2, dx), _mm_mul_ps(s2, dy)) };
+			__m128 d2y{ _mm_sub_ps(_mm_mul_ps(c2, dy), _mm_mul_ps(s2, dx)) };
+			__m128 cd{ abs(_mm_add_ps(_mm_mul_ps(c1, c2), _mm_mul_ps(s1, s2))) };
+			__m128 sd{ abs(_mm_sub_ps(_mm_mul_ps(c1, s2), _mm_mul_ps(s1, c2))) };
+
+			__m128 face1x{ _mm_sub_ps(_mm_sub_ps(abs(d1x), h1x), _mm_add_ps(_mm_mul_ps(cd, h2x), _mm_mul_ps(sd, h2y))) };
+			__m128 face1y{ _mm_sub_ps(_mm_sub_ps(abs(d1y), h1y), _mm_add_ps(_mm_mul_ps(sd, h2x), _mm_mul_ps(cd, h2y))) };
+			__m128 face2x{ _mm_sub_ps(_mm_sub_ps(abs(d2x), h2x), _mm_add_ps(_mm_mul_ps(cd, h1x), _mm_mul_ps(sd, h1y))) };
+			__m128 face2y{ _mm_sub_ps(_mm_sub_ps(abs(d2y), h2y), _mm_add_ps(_mm_mul_ps(sd, h1x), _mm_mul_ps(cd, h1y))) };
+			__m128 worst{ _mm_max_ps(_mm_max_ps(face1x, face1y), _mm_max_ps(face2x, face2y)) };
+
+			uint32_t bits{ static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(worst, zero))) };
+			if (bits) {
+				//k is a multiple of 4 so the 4 bits never straddle a word
+				mask[k >> 5] |= bits << (k & 31);
+				hits += static_cast<size_t>((bits & 1) + ((bits >> 1) & 1) + ((bits >> 2) & 1) + ((bits >> 3) & 1));
+			}
+		}
+		return hits + BoxFaceTestScalar(soa, k, mask);
+	}
+#endif
+
+	/*  _________________________________________________________________________ */
+	/*! WriteContact
+
+	@param c The contact to write.
+	@param point The point between the two surfaces.
+	@param normal The contact normal, from b1 to b2.
+	@param separation Negative when penetrating.
+
+	@return none.
+	*/
+	void WriteContact(Contact& c, Vec2 const& point, Vec2 const& normal, float separation) {
+		c = Contact{};
+		c.position = point;
+		c.normal = normal;
+		c.seperation = separation;
+	}
+}
+
+namespace Collision {
+	/*  _________________________________________________________________________ */
+	/*! MakeHull
+
+	@param rb The rigid body.
+	@param collider The collider of the body.
+
+	@return The core of the shape in world space.
+
+	Boxes and polygons have radius 0, capsules are a 2 vertex core.
+	Polygons with fewer than 3 vertices fall back to the box.
+	*/
+	Hull MakeHull(RigidBody const& rb, BoxCollider const& collider) {
+		Hull hull{};
+		Vec2 cs{ rb.GetRotationCosSin() };
+		float c{ cs.x }, s{ cs.y };
+		Vec2 h{ rb.dimension * .5f };
+
+		if (collider.shape == ColliderShape::CAPSULE) {
+			//rounded segment along the longer side
+			bool vertical{ rb.dimension.y >= rb.dimension.x };
+			hull.radius = vertical ? h.x : h.y;
+			float half{ std::max((vertical ? h.y : h.x) - hull.radius, EPSILON) };
+			Vec2 axis{ vertical ? Vec2{ 0.f, half } : Vec2{ half, 0.f } };
+			hull.count = 2;
+			hull.vertices[0] = rb.position + Rotate(axis * -1.f, c, s);
+			hull.vertices[1] = rb.position + Rotate(axis, c, s);
+		}
+		else if (collider.shape == ColliderShape::POLYGON && collider.vertexCount >= 3) {
+			hull.count = collider.vertexCount;
+			for (uint32_t i{}; i < hull.count; ++i) {
+				Vec2 local{ collider.vertices[i].x * rb.dimension.x, collider.vertices[i].y * rb.dimension.y };
+				hull.vertices[i] = rb.position + Rotate(local, c, s);
+			}
+		}
+		else {
+			hull.count = 4;
+			hull.vertices[0] = rb.position + Rotate(Vec2{ -h.x, -h.y }, c, s);
+			hull.vertices[1] = rb.position + Rotate(Vec2{ h.x, -h.y }, c, s);
+			hull.vertices[2] = rb.position + Rotate(Vec2{ h.x, h.y }, c, s);
+			hull.vertices[3] = rb.position + Rotate(Vec2{ -h.x, h.y }, c, s);
+		}
+
+		//outward normals of counter clockwise edges, a 2 vertex core gets both sides
+		for (uint32_t i{}; i < hull.count; ++i) {
+			Vec2 edge{ hull.vertices[(i + 1) % hull.count] - hull.vertices[i] };
+			hull.normals[i] = normalized(Vec2{ edge.y, -edge.x });
+		}
+		return hull;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! BoxFaceTestBatch
+
+	@param soa The box pairs.
+	@param mask Output hit bits, needs (soa.Size() + 31) / 32 words. bit k is
+	set when no face axis separates pair k.
+
+	@return The number of pairs that may touch.
+
+	The early out of the box clipping kernel for a whole block of pairs, so
+	only the pairs that pass pay for the clipping. The mask is cleared first.
+	*/
+	size_t BoxFaceTestBatch(BoxPairSoA const& soa, uint32_t* mask) {
+		std::memset(mask, 0, ((soa.Size() + 31) / 32) * sizeof(uint32_t));
+#ifdef IMAGE_NARROWPHASE_SSE
+		//sse2 is baseline on every x64 target
+		return BoxFaceTestSSE(soa, mask);
+#else
+		return BoxFaceTestScalar(soa, 0, mask);
+#endif
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! CollideCircles
+
+	@param contacts Output contacts.
+	@param b1 The first circle.
+	@param c1 The collider of the first circle.
+	@param b2 The second circle.
+	@param c2 The collider of the second circle.
+
+	@return The number of contacts, 0 or 1.
+	*/
+	uint32_t CollideCircles(Contact* contacts, RigidBody const& b1, [[maybe_unused]] BoxCollider const& c1,
+		RigidBody const& b2, [[maybe_unused]] BoxCollider const& c2) {
+		float r1{ b1.dimension.x * .5f }, r2{ b2.dimension.x * .5f };
+		Vec2 d{ b2.position - b1.position };
+		float distSq{ dot(d, d) };
+		float totalRadius{ r1 + r2 };
+		if (distSq > totalRadius * totalRadius) return 0;
+
+		float dist{ sqrtf(distSq) };
+		Vec2 normal{ dist > EPSILON ? d * (1.f / dist) : Vec2{ 0.f, 1.f } };
+		Vec2 point{ (b1.position + normal * r1 + b2.position - normal * r2) * .5f };
+		WriteContact(contacts[0], point, normal, dist - totalRadius);
+		return 1;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! CollideBoxCircle
+
+	@param contacts Output contacts.
+	@param b1 The box.
+	@param c1 The collider of the box.
+	@param b2 The circle.
+	@param c2 The collider of the circle.
+
+	@return The number of contacts, 0 or 1.
+
+	Clamps the circle center into the box's local frame, no hull is built.
+	*/
+	uint32_t CollideBoxCircle(Contact* contacts, RigidBody const& b1, [[maybe_unused]] BoxCollider const& c1,
+		RigidBody const& b2, [[maybe_unused]] BoxCollider const& c2) {
+		Vec2 cs{ b1.GetRotationCosSin() };
+		float c{ cs.x }, s{ cs.y };
+		Vec2 h{ b1.dimension * .5f };
+		float radius{ b2.dimension.x * .5f };
+		Vec2 d{ b2.position - b1.position };
+		Vec2 local{ c * d.x + s * d.y, -s * d.x + c * d.y };
+
+		Vec2 closest{ std::clamp(local.x, -h.x, h.x), std::clamp(local.y, -h.y, h.y) };
+		Vec2 localNormal{};
+		float dist{};
+		uint32_t feature{};
+		if (closest.x == local.x && closest.y == local.y) {
+			//center inside the box, push out through the nearest face
+			float px{ h.x - fabs(local.x) }, py{ h.y - fabs(local.y) };
+			if (px < py) {
+				localNormal = Vec2{ local.x < 0.f ? -1.f : 1.f, 0.f };
+				closest.x = localNormal.x * h.x;
+				dist = -px;
+			}
+			else {
+				localNormal = Vec2{ 0.f, local.y < 0.f ? -1.f : 1.f };
+				closest.y = localNormal.y * h.y;
+				dist = -py;
+			}
+		}
+		else {
+			Vec2 delta{ local - closest };
+			float distSq{ dot(delta, delta) };
+			if (distSq > radius * radius) return 0;
+			dist = sqrtf(distSq);
+			localNormal = dist > EPSILON ? delta * (1.f / dist) : Vec2{ 0.f, 1.f };
+		}
+		//face or corner region, so warm starting resets when the circle rolls off an edge
+		feature = (closest.x == h.x) | ((closest.x == -h.x) << 1) | ((closest.y == h.y) << 2) | ((closest.y == -h.y) << 3);
+
+		Vec2 normal{ Rotate(localNormal, c, s) };
+		Vec2 point{ (b1.position + Rotate(closest, c, s) + b2.position - normal * radius) * .5f };
+		WriteContact(contacts[0], point, normal, dist - radius);
+		contacts[0].feature.e.inEdge1 = static_cast<EdgeNumbers>(feature);
+		return 1;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! CollideHullCircle
+
+	@param contacts Output contacts.
+	@param b1 The capsule, polygon or box.
+	@param c1 The collider of b1.
+	@param b2 The circle.
+	@param c2 The collider of the circle.
+
+	@return The number of contacts, 0 or 1.
+
+	Finds the edge of the core facing the circle, then the closest point on
+	that edge.
+	*/
+	uint32_t CollideHullCircle(Contact* contacts, RigidBody const& b1, BoxCollider const& c1,
+		RigidBody const& b2, [[maybe_unused]] BoxCollider const& c2) {
+		Hull hull{ MakeHull(b1, c1) };
+		Vec2 center{ b2.position };
+		float radius{ b2.dimension.x * .5f };
+		float totalRadius{ hull.radius + radius };
+
+		uint32_t edge{};
+		float separation{ -FLOAT_MAX };
+		for (uint32_t i{}; i < hull.count; ++i) {
+			float s{ dot(hull.normals[i], center - hull.vertices[i]) };
+			if (s > separation) {
+				separation = s;
+				edge = i;
+			}
+		}
+		if (separation > totalRadius) return 0;
+
+		Vec2 closest{}, normal{};
+		float dist{};
+		if (separation < EPSILON) {
+			//center inside the core
+			normal = hull.normals[edge];
+			closest = center - normal * separation;
+			dist = separation;
+		}
+		else {
+			closest = ClosestPointOnSegment(center, hull.vertices[edge], hull.vertices[(edge + 1) % hull.count]);
+			Vec2 delta{ center - closest };
+			float distSq{ dot(delta, delta) };
+			if (distSq > totalRadius * totalRadius) return 0;
+			dist = sqrtf(distSq);
+			normal = dist > EPSILON ? delta * (1.f / dist) : hull.normals[edge];
+		}
+
+		Vec2 point{ (closest + normal * hull.radius + center - normal * radius) * .5f };
+		WriteContact(contacts[0], point, normal, dist - totalRadius);
+		contacts[0].feature.e.inEdge1 = EdgeFeature(edge);
+		return 1;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! CollideHulls
+
+	@param contacts Output contacts.
+	@param b1 The first body.
+	@param c1 The collider of the first body.
+	@param b2 The second body.
+	@param c2 The collider of the second body.
+
+	@return The number of contacts, up to 2.
+
+	Separating axis test on the edge normals of both cores, then the
+	incident edge is clipped against the reference edge like the box kernel.
+	When only the rounded parts touch (capsule caps) a single contact is
+	made from the closest points of the two edges.
+	*/
+	uint32_t CollideHulls(Contact* contacts, RigidBody const& b1, BoxCollider const& c1,
+		RigidBody const& b2, BoxCollider const& c2) {
+		Hull hullA{ MakeHull(b1, c1) };
+		Hull hullB{ MakeHull(b2, c2) };
+		float totalRadius{ hullA.radius + hullB.radius };
+
+		uint32_t edgeA{}, edgeB{};
+		float separationA{ FindMaxSeparation(edgeA, hullA, hullB) };
+		if (separationA > totalRadius) return 0;
+		float separationB{ FindMaxSeparation(edgeB, hullB, hullA) };
+		if (separationB > totalRadius) return 0;
+
+		bool flip{ separationB > RELATIVE_TOL * separationA + ABSOLUTE_TOL };
+		Hull const& ref{ flip ? hullB : hullA };
+		Hull const& inc{ flip ? hullA : hullB };
+		uint32_t refEdge{ flip ? edgeB : edgeA };
+		float separation{ flip ? separationB : separationA };
+
+		Vec2 refNormal{ ref.normals[refEdge] };
+		Vec2 v11{ ref.vertices[refEdge] };
+		Vec2 v12{ ref.vertices[(refEdge + 1) % ref.count] };
+
+		//incident edge, the one most against the reference normal
+		uint32_t incEdge{};
+		float minDot{ FLOAT_MAX };
+		for (uint32_t i{}; i < inc.count; ++i) {
+			float d{ dot(refNormal, inc.normals[i]) };
+			if (d < minDot) {
+				minDot = d;
+				incEdge = i;
+			}
+		}
+		uint32_t incNext{ (incEdge + 1) % inc.count };
+
+		//cores apart (or touching end to end, which no face axis of a segment
+		//can separate), only the radii overlap
+		if (totalRadius > 0.f && separation > -EPSILON) {
+			Vec2 p1{}, p2{};
+			ClosestPointsSegments(v11, v12, inc.vertices[incEdge], inc.vertices[incNext], p1, p2);
+			Vec2 delta{ p2 - p1 };
+			float distSq{ dot(delta, delta) };
+			if (distSq > totalRadius * totalRadius) return 0;
+			float dist{ sqrtf(distSq) };
+			Vec2 normal{ dist > EPSILON ? delta * (1.f / dist) : refNormal };
+			//parallel faces still get 2 clipped points below
+			if (dot(normal, refNormal) < 0.99f) {
+				Vec2 point{ (p1 + normal * ref.radius + p2 - normal * inc.radius) * .5f };
+				WriteContact(contacts[0], point, flip ? normal * -1.f : normal, dist - totalRadius);
+				contacts[0].feature.e.inEdge1 = EdgeFeature(flip ? incEdge : refEdge);
+				contacts[0].feature.e.inEdge2 = EdgeFeature(flip ? refEdge : incEdge);
+				return 1;
+			}
+		}
+
+		ClipVertex incidentEdge[2];
+		incidentEdge[0].v = inc.vertices[incEdge];
+		incidentEdge[0].fp.e.inEdge2 = EdgeFeature((incEdge + inc.count - 1) % inc.count);
+		incidentEdge[0].fp.e.outEdge2 = EdgeFeature(incEdge);
+		incidentEdge[1].v = inc.vertices[incNext];
+		incidentEdge[1].fp.e.inEdge2 = EdgeFeature(incEdge);
+		incidentEdge[1].fp.e.outEdge2 = EdgeFeature(incNext);
+
+		Vec2 tangent{ normalized(v12 - v11) };
+		float negSide{ -dot(tangent, v11) };
+		float posSide{ dot(tangent, v12) };
+		float negEdge{ static_cast<float>(static_cast<uint32_t>(EdgeFeature((refEdge + ref.count - 1) % ref.count))) };
+		float posEdge{ static_cast<float>(static_cast<uint32_t>(EdgeFeature((refEdge + 1) % ref.count))) };
+
+		ClipVertex clipPoints1[2];
+		ClipVertex clipPoints2[2];
+		if (ClipSegmentToLine(clipPoints1, incidentEdge, tangent * -1.f, negSide, negEdge) < 2) return 0;
+		if (ClipSegmentToLine(clipPoints2, clipPoints1, tangent, posSide, posEdge) < 2) return 0;
+
+		float front{ dot(refNormal, v11) };
+		uint32_t numContacts{};
+		for (uint32_t i{}; i < 2; ++i) {
+			float raw{ dot(refNormal, clipPoints2[i].v) - front };
+			float s{ raw - totalRadius };
+			if (s > 0.f) continue;
+
+			Contact& contact{ contacts[numContacts++] };
+			Vec2 point{ clipPoints2[i].v + refNormal * ((ref.radius - inc.radius - raw) * .5f) };
+			WriteContact(contact, point, flip ? refNormal * -1.f : refNormal, s);
+			contact.feature = clipPoints2[i].fp;
+			if (flip) {
+				std::swap(contact.feature.e.inEdge1, contact.feature.e.inEdge2);
+				std::swap(contact.feature.e.outEdge1, contact.feature.e.outEdge2);
+			}
+		}
+		return numContacts;
+	}
+}
@@ -0,0 +1,166 @@
+/******************************************************************************/
+/*!
+\par        Image Engine
+\file       TerrainGrid.cpp
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief		baked uniform grid of static level terrain
+
+			tiles are merged in two greedy passes, first into horizontal
+			strips of equal height, then strips of equal width are stacked.
+			only tiles with the same friction and filter bits are merged so
+			the merged rect behaves exactly like every tile in it.
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+			or disclosure of this file or its contents without the prior
+			written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+#include "../../include/Math/TerrainGrid.hpp"
+#include <tuple>
+
+namespace {
+	//tiles placed by hand in the editor are rarely exactly flush
+	constexpr float MERGE_EPSILON{ 1e-3f };
+	//keeps a level with a few far away tiles from allocating a huge grid
+	constexpr int MAX_GRID_CELLS_PER_AXIS{ 512 };
+
+	bool Near(float a, float b) { return fabsf(a - b) <= MERGE_EPSILON; }
+
+	template <typename T, typename U>
+	bool SameMaterial(T const& a, U const& b) {
+		return a.category == b.category && a.mask == b.mask && a.friction == b.friction;
+	}
+	template <typename T>
+	auto MaterialKey(T const& t) { return std::make_tuple(t.category, t.mask, t.friction); }
+}
+
+namespace Collision {
+	/*  _________________________________________________________________________ */
+	/*! TerrainGrid::Clear
+
+	@return none.
+
+	Removes all terrain, queries return nothing until the next Build.
+	*/
+	void TerrainGrid::Clear() {
+		mRects.clear();
+		mTiles.clear();
+		mCellStart.clear();
+		mCellRects.clear();
+		mStamps.clear();
+		mCols = mRows = 0;
+	}
+	/*  _________________________________________________________________________ */
+	/*! TerrainGrid::Build
+
+	@param tiles The static boxes of the level.
+	@param cellSize Edge length of a grid cell in world units.
+
+	@return none.
+
+	Merges the tiles into solid rects and buckets every rect into each cell
+	it overlaps.
+	*/
+	void TerrainGrid::Build(std::vector<TerrainTile> tiles, float cellSize) {
+		Clear();
+		if (tiles.empty()) return;
+
+		//rows of equal height, left to right
+		std::sort(tiles.begin(), tiles.end(), [](TerrainTile const& a, TerrainTile const& b) {
+			return std::make_tuple(MaterialKey(a), a.min.y, a.max.y, a.min.x) <
+				std::make_tuple(MaterialKey(b), b.min.y, b.max.y, b.min.x);
+		});
+		std::vector<TerrainRect> strips;
+		std::vector<uint32_t> stripOf(tiles.size());
+		for (uint32_t i{}; i < tiles.size(); ++i) {
+			TerrainTile const& t{ tiles[i] };
+			if (!strips.empty()) {
+				TerrainRect& s{ strips.back() };
+				if (SameMaterial(s, t) && Near(s.min.y, t.min.y) && Near(s.max.y, t.max.y) && t.min.x <= s.max.x + MERGE_EPSILON) {
+					s.max.x = std::max(s.max.x, t.max.x);
+					stripOf[i] = static_cast<uint32_t>(strips.size() - 1);
+					continue;
+				}
+			}
+			stripOf[i] = static_cast<uint32_t>(strips.size());
+			strips.emplace_back(TerrainRect{ t.min, t.max, t.friction, t.category, t.mask });
+		}
+
+		//stack strips of equal width, bottom to top
+		std::vector<uint32_t> stripOrder(strips.size());
+		for (uint32_t i{}; i < stripOrder.size(); ++i) stripOrder[i] = i;
+		std::sort(stripOrder.begin(), stripOrder.end(), [&strips](uint32_t a, uint32_t b) {
+			TerrainRect const& sa{ strips[a] };
+			TerrainRect const& sb{ strips[b] };
+			return std::make_tuple(MaterialKey(sa), sa.min.x, sa.max.x, sa.min.y) <
+				std::make_tuple(MaterialKey(sb), sb.min.x, sb.max.x, sb.min.y);
+		});
+		std::vector<uint32_t> rectOf(strips.size());
+		for (auto const& i : stripOrder) {
+			TerrainRect const& s{ strips[i] };
+			if (!mRects.empty()) {
+				TerrainRect& r{ mRects.back() };
+				if (SameMaterial(r, s) && Near(r.min.x, s.min.x) && Near(r.max.x, s.max.x) && s.min.y <= r.max.y + MERGE_EPSILON) {
+					r.max.y = std::max(r.max.y, s.max.y);
+					rectOf[i] = static_cast<uint32_t>(mRects.size() - 1);
+					continue;
+				}
+			}
+			rectOf[i] = static_cast<uint32_t>(mRects.size());
+			mRects.emplace_back(s);
+		}
+
+		//group the tiles by rect, the lowest entity stands in for the rect
+		std::vector<uint32_t> tileOrder(tiles.size());
+		for (uint32_t i{}; i < tileOrder.size(); ++i) tileOrder[i] = i;
+		std::sort(tileOrder.begin(), tileOrder.end(), [&](uint32_t a, uint32_t b) {
+			return std::make_pair(rectOf[stripOf[a]], tiles[a].entity) < std::make_pair(rectOf[stripOf[b]], tiles[b].entity);
+		});
+		mTiles.reserve(tiles.size());
+		for (auto const& i : tileOrder) {
+			TerrainRect& r{ mRects[rectOf[stripOf[i]]] };
+			if (!r.tileCount) {
+				r.firstTile = static_cast<uint32_t>(mTiles.size());
+				r.entity = tiles[i].entity;
+			}
+			++r.tileCount;
+			mTiles.emplace_back(tiles[i]);
+		}
+
+		//grid over the bounds of the terrain
+		Vec2 lo{ mRects.front().min }, hi{ mRects.front().max };
+		for (auto const& r : mRects) {
+			lo = Vec2{ std::min(lo.x, r.min.x), std::min(lo.y, r.min.y) };
+			hi = Vec2{ std::max(hi.x, r.max.x), std::max(hi.y, r.max.y) };
+		}
+		float span{ std::max(hi.x - lo.x, hi.y - lo.y) };
+		cellSize = std::max(cellSize, span / MAX_GRID_CELLS_PER_AXIS);
+		mOrigin = lo;
+		mInvCellSize = 1.f / cellSize;
+		mCols = CellX(hi.x) + 1;
+		mRows = CellY(hi.y) + 1;
+
+		//two passes, count then fill, so the cells share one flat array
+		size_t cellCount{ static_cast<size_t>(mCols) * mRows };
+		mCellStart.assign(cellCount + 1, 0u);
+		auto forCells = [this](TerrainRect const& r, auto fn) {
+			for (int y{ std::max(CellY(r.min.y), 0) }; y <= std::min(CellY(r.max.y), mRows - 1); ++y) {
+				for (int x{ std::max(CellX(r.min.x), 0) }; x <= std::min(CellX(r.max.x), mCols - 1); ++x) {
+					fn(static_cast<size_t>(y) * mCols + x);
+				}
+			}
+		};
+		for (auto const& r : mRects) forCells(r, [this](size_t c) { ++mCellStart[c + 1]; });
+		for (size_t c{}; c < cellCount; ++c) mCellStart[c + 1] += mCellStart[c];
+		mCellRects.resize(mCellStart[cellCount]);
+		std::vector<uint32_t> cursor(mCellStart.begin(), mCellStart.end() - 1);
+		for (uint32_t i{}; i < mRects.size(); ++i) {
+			forCells(mRects[i], [&](size_t c) { mCellRects[cursor[c]++] = i; });
+		}
+		mStamps.assign(mRects.size(), 0u);
+		mQueryId = 0;
+	}
+}
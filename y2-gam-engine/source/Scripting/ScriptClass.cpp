@@ -92,6 +92,25 @@ namespace Image {
     return ret;
   }
 
+  /*  _________________________________________________________________________ */
+  /*! FindMethod
+
+  @param name
+  Name of the method.
+
+  @param numParameters
+  Number of parameters in the method.
+
+  @return MonoMethod*
+  The method, or nullptr if the script does not define it.
+
+  Same as GetMethod but for optional callbacks, a missing method is not an
+  error.
+  */
+  MonoMethod* ScriptClass::FindMethod(std::string const& name, int numParameters) const {
+    return mono_class_get_method_from_name(mMonoClass, name.c_str(), numParameters);
+  }
+
   /*  _________________________________________________________________________ */
   /*! CallMethod
 
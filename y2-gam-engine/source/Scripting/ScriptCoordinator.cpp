@@ -25,6 +25,8 @@
 #include "Components/Rigidbody.hpp"
 #include "Components/Animation.hpp"
 #include "Systems/InputSystem.hpp"
+#include "Systems/CollisionSystem.hpp"
+#include "Scripting/ScriptManager.hpp"
 
 namespace {
 	std::shared_ptr<Coordinator> gCoordinator;
@@ -320,6 +322,128 @@ namespace Image {
 		return inputSystem->CheckKey(InputSystem::InputKeyState::MOUSE_RELEASED, key);
 	}
 
+	// For Physics
+	/*  _________________________________________________________________________ */
+	/*! ToEntityArray
+
+	@param entities
+	The entity IDs to copy.
+
+	@return MonoArray*
+	A managed uint[] holding the entity IDs.
+
+	Copies a list of entities into a new managed array for C#.
+	*/
+	static MonoArray* ToEntityArray(std::vector<Entity> const& entities) {
+		MonoArray* arr{ mono_array_new(ScriptManager::GetAppDomain(), mono_get_uint32_class(), entities.size()) };
+		for (size_t i{}; i < entities.size(); ++i) {
+			mono_array_set(arr, uint32_t, i, entities[i]);
+		}
+		return arr;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! Physics_Raycast
+
+	@param origin
+	Start of the ray.
+
+	@param end
+	End of the ray.
+
+	@param outEntity
+	The ID of the closest entity hit.
+
+	@param outPoint
+	The point where the ray hits.
+
+	@param outNormal
+	The normal of the face that is hit.
+
+	@param outFraction
+	How far along the ray the hit is, from 0 to 1.
+
+	@return bool
+	Returns true if something is hit.
+
+	Cast a ray against the colliders and get the closest hit in C#.
+	*/
+	static bool Physics_Raycast(Vec2* origin, Vec2* end, uint32_t* outEntity, Vec2* outPoint, Vec2* outNormal, float* outFraction) {
+		::gCoordinator = Coordinator::GetInstance();
+		Collision::RaycastHit hit{};
+		if (!::gCoordinator->GetSystem<Collision::CollisionSystem>()->Raycast(*origin, *end, hit)) return false;
+		*outEntity = hit.entity;
+		*outPoint = hit.point;
+		*outNormal = hit.normal;
+		*outFraction = hit.fraction;
+		return true;
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! Physics_RaycastAll
+
+	@param origin
+	Start of the ray.
+
+	@param end
+	End of the ray.
+
+	@return MonoArray*
+	The IDs of every entity hit, nearest first.
+
+	Cast a ray against the colliders and get every hit in C#.
+	*/
+	static MonoArray* Physics_RaycastAll(Vec2* origin, Vec2* end) {
+		::gCoordinator = Coordinator::GetInstance();
+		std::vector<Collision::RaycastHit> hits;
+		::gCoordinator->GetSystem<Collision::CollisionSystem>()->RaycastAll(*origin, *end, hits);
+		std::vector<Entity> entities;
+		for (auto const& hit : hits) entities.emplace_back(hit.entity);
+		return ToEntityArray(entities);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! Physics_QueryAABB
+
+	@param min
+	The bottom left corner of the region.
+
+	@param max
+	The top right corner of the region.
+
+	@return MonoArray*
+	The IDs of every entity overlapping the region.
+
+	Get the entities in a box region in C#.
+	*/
+	static MonoArray* Physics_QueryAABB(Vec2* min, Vec2* max) {
+		::gCoordinator = Coordinator::GetInstance();
+		std::vector<Entity> entities;
+		::gCoordinator->GetSystem<Collision::CollisionSystem>()->QueryAABB(*min, *max, entities);
+		return ToEntityArray(entities);
+	}
+
+	/*  _________________________________________________________________________ */
+	/*! Physics_QueryRadius
+
+	@param center
+	The center of the circle.
+
+	@param radius
+	The radius of the circle.
+
+	@return MonoArray*
+	The IDs of every entity within the circle, nearest first.
+
+	Get the entities within a radius in C#.
+	*/
+	static MonoArray* Physics_QueryRadius(Vec2* center, float radius) {
+		::gCoordinator = Coordinator::GetInstance();
+		std::vector<Entity> entities;
+		::gCoordinator->GetSystem<Collision::CollisionSystem>()->QueryRadius(*center, radius, entities);
+		return ToEntityArray(entities);
+	}
+
 	/*  _________________________________________________________________________ */
 	/*! RegisterFunctions
 
@@ -348,5 +472,10 @@ namespace Image {
 		IMAGE_ADD_INTERNAL_CALL(Input_IsMousePressed);
 		IMAGE_ADD_INTERNAL_CALL(Input_IsMouseClicked);
 		IMAGE_ADD_INTERNAL_CALL(Input_IsMouseReleased);
+
+		IMAGE_ADD_INTERNAL_CALL(Physics_Raycast);
+		IMAGE_ADD_INTERNAL_CALL(Physics_RaycastAll);
+		IMAGE_ADD_INTERNAL_CALL(Physics_QueryAABB);
+		IMAGE_ADD_INTERNAL_CALL(Physics_QueryRadius);
 	}
 }
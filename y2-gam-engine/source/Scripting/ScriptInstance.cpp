@@ -37,6 +37,10 @@ namespace Image {
     mConstructor{ scriptClass.GetMethod(".ctor", 1) },
     mOnCreateMethod{ scriptClass.GetMethod("OnCreate", 0) },
     mOnUpdateMethod{ scriptClass.GetMethod("OnUpdate", 1) },
+    mOnContactBeginMethod{ scriptClass.FindMethod("OnContactBegin", 1) },
+    mOnContactEndMethod{ scriptClass.FindMethod("OnContactEnd", 1) },
+    mOnTriggerBeginMethod{ scriptClass.FindMethod("OnTriggerBegin", 1) },
+    mOnTriggerEndMethod{ scriptClass.FindMethod("OnTriggerEnd", 1) },
     mScriptClass{ scriptClass } {
 
     // Call the non-default, single parameter constructor from C#
@@ -70,4 +74,79 @@ namespace Image {
     void* dtParam{ &dt };
     mScriptClass.CallMethod(mInstance, mOnUpdateMethod, &dtParam);
   }
+
+  /*  _________________________________________________________________________ */
+  /*! CallOptional
+
+  @param method
+  The optional mono method, may be nullptr.
+
+  @param other
+  The other entity in the contact.
+
+  @return none.
+
+  Calls a single parameter callback if the script defines it.
+  */
+  void ScriptInstance::CallOptional(MonoMethod* method, Entity other) {
+    if (method == nullptr) return;
+    void* otherParam{ &other };
+    mScriptClass.CallMethod(mInstance, method, &otherParam);
+  }
+
+  /*  _________________________________________________________________________ */
+  /*! CallOnContactBegin
+
+  @param other
+  The entity that started touching this one.
+
+  @return none.
+
+  Calls OnContactBegin from C# if it exists.
+  */
+  void ScriptInstance::CallOnContactBegin(Entity other) {
+    CallOptional(mOnContactBeginMethod, other);
+  }
+
+  /*  _________________________________________________________________________ */
+  /*! CallOnContactEnd
+
+  @param other
+  The entity that stopped touching this one.
+
+  @return none.
+
+  Calls OnContactEnd from C# if it exists.
+  */
+  void ScriptInstance::CallOnContactEnd(Entity other) {
+    CallOptional(mOnContactEndMethod, other);
+  }
+
+  /*  _________________________________________________________________________ */
+  /*! CallOnTriggerBegin
+
+  @param other
+  The entity that started overlapping this one.
+
+  @return none.
+
+  Calls OnTriggerBegin from C# if it exists.
+  */
+  void ScriptInstance::CallOnTriggerBegin(Entity other) {
+    CallOptional(mOnTriggerBeginMethod, other);
+  }
+
+  /*  _________________________________________________________________________ */
+  /*! CallOnTriggerEnd
+
+  @param other
+  The entity that stopped overlapping this one.
+
+  @return none.
+
+  Calls OnTriggerEnd from C# if it exists.
+  */
+  void ScriptInstance::CallOnTriggerEnd(Entity other) {
+    CallOptional(mOnTriggerEndMethod, other);
+  }
 }
@@ -323,6 +323,33 @@ namespace Image {
     sEntityInstances[entity].CallOnUpdate(dt);
   }
 
+  /*  _________________________________________________________________________ */
+  /*! OnContactEvent
+
+  @param event
+  A contact or trigger begin/end event from the collision system.
+
+  @return none.
+
+  Forwards the event to the scripts on both entities of the pair, each
+  receiving the other entity. Entities without a script are skipped.
+  */
+  void ScriptManager::OnContactEvent(Event& event) {
+    auto const& [a, b] { event.GetParam<std::pair<Entity, Entity>>(Events::Physics::Pair::ENTITIES) };
+    EventId const type{ event.GetType() };
+
+    auto dispatch = [type](Entity self, Entity other) {
+      auto it{ sEntityInstances.find(self) };
+      if (it == sEntityInstances.end()) return;
+      if (type == Events::Physics::CONTACT_BEGIN) it->second.CallOnContactBegin(other);
+      else if (type == Events::Physics::CONTACT_END) it->second.CallOnContactEnd(other);
+      else if (type == Events::Physics::TRIGGER_BEGIN) it->second.CallOnTriggerBegin(other);
+      else if (type == Events::Physics::TRIGGER_END) it->second.CallOnTriggerEnd(other);
+    };
+    dispatch(a, b);
+    dispatch(b, a);
+  }
+
   /*  _________________________________________________________________________ */
   /*! EntityClassExists
 
@@ -46,17 +46,15 @@ void AnimationSystem::Init() {
 	::gCoordinator = Coordinator::GetInstance();
 
 	//-------------TEMPORARY-------------------------------------------------------------/
-	mIdle.reset(new Texture{ "../Textures/Idle.png" });
-	mRun.reset(new Texture{ "../Textures/Run.png" });
-	mAttack.reset(new Texture{ "../Textures/Attack_1.png" });
-	for (float i{}; i < 8; ++i)
-		mSpriteList.push_back(SubTexture::Create(mIdle, { i, 0 }, { 128, 128 }));
+	//the sheets are packed into the atlas, see data/assets.json
+	for (unsigned int i{}; i < 8; ++i)
+		mSpriteList.push_back(SubTexture::Create("../Textures/Idle.png", i));
 
-	for(float i{8}; i < 16; ++i)
-		mSpriteList.push_back(SubTexture::Create(mRun, {i, 0}, {128, 128}));
+	for (unsigned int i{}; i < 8; ++i)
+		mSpriteList.push_back(SubTexture::Create("../Textures/Run.png", i));
 
-	for(float i{16}; i <23; ++i)
-		mSpriteList.push_back(SubTexture::Create(mAttack, { i, 0 }, { 128, 128 }));
+	for (unsigned int i{}; i < 7; ++i)
+		mSpriteList.push_back(SubTexture::Create("../Textures/Attack_1.png", i));
 
 	//------------------------------------------------------------------------------------/
 
@@ -24,6 +24,7 @@
 #include <Math/Collision.hpp>
 #include <Core/Types.hpp>
 #include "Math/MathUtils.h"
+#include <bit>
 
 namespace {
 	std::shared_ptr<Coordinator> gCoordinator;
@@ -33,82 +34,56 @@ namespace Collision{
     inline Vec2 vabs(Vec2 const& v) { return Vec2{ fabs(v.x), fabs(v.y) }; }
     inline Mat22 mabs(Mat22 const&m) { return Mat22{vabs(m.mMat[0]),vabs(m.mMat[1])}; }
     /*  _________________________________________________________________________ */
-/*! Mat22FromAngle
+/*! Mat22FromBody
 
-@param rads The angle in radians.
+@param rb The body.
 
-@return Mat22 A 2x2 matrix representing a rotation.
+@return Mat22 A 2x2 matrix representing the rotation of the body.
 
-Creates a 2x2 rotation matrix from the given angle in radians.
+Builds the rotation matrix of the body from its cached sin and cos.
 */
 
-    Mat22 Mat22FromAngle(float rads) {
-        float c = cosf(rads);
-        float s = sinf(rads);
+    Mat22 Mat22FromBody(RigidBody const& rb) {
+        Vec2 cs{ rb.GetRotationCosSin() };
         return Mat22{
-            c, s,
-            -s, c
-        };
-    }
-    /*  _________________________________________________________________________ */
-/*! Mat33FromAngle
-
-@param rads The angle in radians.
-
-@return Mat33 A 3x3 matrix representing a rotation.
-
-Creates a 3x3 rotation matrix from the given angle in radians.
-*/
-
-    Mat33 Mat33FromAngle(float rads) {
-        float c = cosf(rads);
-        float s = sinf(rads);
-        return Mat33{
-            c, s, 0,
-            -s, c, 0,
-            0, 0, 1
+            cs.x, cs.y,
+            -cs.y, cs.x
         };
     }
+    using namespace Physics;
     /*  _________________________________________________________________________ */
-/*! Mat33FromTranslate
+/*! GetAABBExtents
 
-@param x The x translation.
-@param y The y translation.
+@param rotation The rotation of the body.
+@param halfExtents Half the dimension of the body.
+@param shape The shape of its collider.
 
-@return Mat33 A 3x3 matrix representing a translation.
+@return Vec2 Half the size of the aabb.
 
-Creates a 3x3 translation matrix from the given x and y values.
+The extents of the rotated box along the world axes. A circle's radius is
+half dimension.x whatever dimension.y is, so its aabb is square.
 */
 
-    Mat33 Mat33FromTranslate(float x, float y) {
-        return Mat33{
-            1,0,0,
-            0,1,0,
-            x,y,1
-        };
+    Vec2 GetAABBExtents(Mat22 const& rotation, Vec2 const& halfExtents, ColliderShape shape) {
+        if (shape == ColliderShape::CIRCLE) return Vec2{ halfExtents.x, halfExtents.x };
+        return vabs(rotation.mMat[0]) * halfExtents.x + vabs(rotation.mMat[1]) * halfExtents.y;
     }
-    using namespace Physics;
     //returns the min and max values of the 
     /*  _________________________________________________________________________ */
 /*! GetAABBBody
 
 @param rb A reference to a RigidBody.
+@param shape The shape of its collider.
 
 @return std::pair<Vec2, Vec2> A pair representing the minimum and maximum corners of the AABB.
 
 Computes the Axis-Aligned Bounding Box (AABB) for a given rigid body.
 */
 
-    std::pair<Vec2, Vec2> GetAABBBody(RigidBody const& rb) {
-        auto transform{ Mat33FromTranslate(rb.position.x, rb.position.y) * Mat33FromAngle(rb.rotation) };
-        Vec2 topleft{ transform * Vec3{ rb.dimension.x * -.5f, rb.dimension.y * .5f, 1.f } };
-        Vec2 topright{ transform * Vec3{ rb.dimension.x * .5f, rb.dimension.y * .5f, 1.f } };
-        Vec2 bottomleft{ transform * Vec3{ rb.dimension.x * -.5f, rb.dimension.y * -.5f, 1.f } };
-        Vec2 bottomright{ transform * Vec3{ rb.dimension.x * .5f, rb.dimension.y * -.5f, 1.f } };
-        return {
-            Vec2{std::min({topleft.x, topright.x, bottomleft.x, bottomright.x}), std::min({topleft.y, topright.y, bottomleft.y, bottomright.y})},
-            Vec2{std::max({topleft.x, topright.x, bottomleft.x, bottomright.x}), std::max({topleft.y, topright.y, bottomleft.y, bottomright.y})}
-        };
+    std::pair<Vec2, Vec2> GetAABBBody(RigidBody const& rb, ColliderShape shape) {
+        //same as the aabb cache
+        Vec2 extents{ GetAABBExtents(Mat22FromBody(rb), rb.dimension * .5f, shape) };
+        return { rb.position - extents, rb.position + extents };
     }
     /*  _________________________________________________________________________ */
 /*! ClipSegmentToLine
@@ -244,18 +219,29 @@ Computes the incident edge of a box against a given normal.
 Computes the collision between two rigid bodies and returns the contact points.
 */
 
-    uint32_t Collide(Physics::Contact* contacts, RigidBody& b1, RigidBody& b2) {
-
+    uint32_t Collide(Physics::Contact* contacts, RigidBody const& b1, RigidBody const& b2) {
+        return CollideOBB(contacts, b1.position, b1.dimension * 0.5f, Mat22FromBody(b1),
+            b2.position, b2.dimension * 0.5f, Mat22FromBody(b2));
+    }
+    /*  _________________________________________________________________________ */
+/*! CollideOBB
 
-        Vec2 h1 = b1.dimension * 0.5f;
-        Vec2 h2 = b2.dimension * 0.5f;
+@param contacts An array of Contact to store the collision contacts.
+@param pos1 Center of the first box.
+@param h1 Half extents of the first box.
+@param rot1 Rotation of the first box.
+@param pos2 Center of the second box.
+@param h2 Half extents of the second box.
+@param rot2 Rotation of the second box.
 
-        Vec2 pos1 = b1.position;
-        Vec2 pos2 = b2.position;
+@return uint32_t The number of contact points.
 
-        Mat22 rot1 = Mat22FromAngle(b1.rotation);
-        Mat22 rot2 = Mat22FromAngle(b2.rotation);
+The box clipping kernel on already computed rotations, so the batched
+narrowphase does not redo the sin/cos per pair.
+*/
 
+    uint32_t CollideOBB(Physics::Contact* contacts, Vec2 const& pos1, Vec2 const& h1, Mat22 const& rot1,
+        Vec2 const& pos2, Vec2 const& h2, Mat22 const& rot2) {
         Mat22 rot1T = Mat22Transpose(rot1); //inverse the rotation
         Mat22 rot2T = Mat22Transpose(rot2);
 
@@ -408,44 +394,144 @@ Computes the collision between two rigid bodies and returns the contact points.
             }
         }
 
-        if (!b1.isGrounded) {
-            b1.isGrounded = (normal.y < 0.0f);
+        return numContacts;
+    }
+    /*  _________________________________________________________________________ */
+/*! CollideBoxes
+
+@param contacts Output contacts.
+@param b1 The first box.
+@param c1 The collider of the first box.
+@param b2 The second box.
+@param c2 The collider of the second box.
+
+@return uint32_t The number of contact points.
+
+Box-box entry of the shape table, forwards to the box clipping kernel.
+*/
+
+    uint32_t CollideBoxes(Contact* contacts, RigidBody const& b1, [[maybe_unused]] BoxCollider const& c1,
+        RigidBody const& b2, [[maybe_unused]] BoxCollider const& c2) {
+        return Collide(contacts, b1, b2);
+    }
+    /*  _________________________________________________________________________ */
+/*! CollideFlipped
+
+@param contacts Output contacts.
+@param b1 The first body.
+@param c1 The collider of the first body.
+@param b2 The second body.
+@param c2 The collider of the second body.
+
+@return uint32_t The number of contact points.
+
+Runs a kernel written for (b2, b1) and flips the result back so the normal
+points from b1 to b2 and the features stay per body.
+*/
+
+    template <CollideFn Fn>
+    uint32_t CollideFlipped(Contact* contacts, RigidBody const& b1, BoxCollider const& c1,
+        RigidBody const& b2, BoxCollider const& c2) {
+        uint32_t count{ Fn(contacts, b2, c2, b1, c1) };
+        for (uint32_t i{}; i < count; ++i) {
+            contacts[i].normal = contacts[i].normal * -1.f;
+            std::swap(contacts[i].feature.e.inEdge1, contacts[i].feature.e.inEdge2);
+            std::swap(contacts[i].feature.e.outEdge1, contacts[i].feature.e.outEdge2);
         }
+        return count;
+    }
 
-        return numContacts;
+    //narrowphase kernel for every [b1 shape][b2 shape]
+    constexpr CollideFn sCollideTable[static_cast<size_t>(ColliderShape::COUNT)][static_cast<size_t>(ColliderShape::COUNT)]{
+        //BOX                               CIRCLE                              CAPSULE                             POLYGON
+        { CollideBoxes,                     CollideBoxCircle,                   CollideHulls,                       CollideHulls },    //BOX
+        { CollideFlipped<CollideBoxCircle>, CollideCircles,                     CollideFlipped<CollideHullCircle>,  CollideFlipped<CollideHullCircle> }, //CIRCLE
+        { CollideHulls,                     CollideHullCircle,                  CollideHulls,                       CollideHulls },    //CAPSULE
+        { CollideHulls,                     CollideHullCircle,                  CollideHulls,                       CollideHulls }     //POLYGON
+    };
+    /*  _________________________________________________________________________ */
+/*! CollideShapes
+
+@param contacts Output contacts, at least MAX_CONTACT_POINTS.
+@param b1 The first body.
+@param c1 The collider of the first body.
+@param b2 The second body.
+@param c2 The collider of the second body.
+
+@return uint32_t The number of contact points.
+
+Looks up the kernel for the shape pair. Unknown shapes are treated as boxes.
+*/
+
+    uint32_t CollideShapes(Contact* contacts, RigidBody const& b1, BoxCollider const& c1,
+        RigidBody const& b2, BoxCollider const& c2) {
+        auto index = [](ColliderShape shape) {
+            return shape < ColliderShape::COUNT ? static_cast<size_t>(shape) : static_cast<size_t>(ColliderShape::BOX);
+        };
+        return sCollideTable[index(c1.shape)][index(c2.shape)](contacts, b1, c1, b2, c2);
     }
     /*  _________________________________________________________________________ */
-/*! Collide
+/*! ShouldCollide
 
-@param b1 The first Entity.
-@param b2 The second Entity.
+@param a The filter of the first collider.
+@param b The filter of the second collider.
 
-@return Arbiter The collision arbiter between the two entities.
+@return bool true if the pair should go to the narrowphase.
 
-Computes the collision between two entities and returns an arbiter.
+Both colliders must accept each other's category. Two static bodies never
+collide since neither can move, and two triggers never report each other.
 */
 
-    Arbiter Collide(Entity b1, Entity b2) {
-        auto & rb1{ Coordinator::GetInstance()->GetComponent<RigidBody>(b1) };
-        auto & rb2{ Coordinator::GetInstance()->GetComponent<RigidBody>(b2) };
+    bool ShouldCollide(ColliderFilter const& a, ColliderFilter const& b) {
+        if (a.isStatic && b.isStatic) return false;
+        if (a.isTrigger && b.isTrigger) return false;
+        return (a.category & b.mask) && (b.category & a.mask);
+    }
+    /*  _________________________________________________________________________ */
+/*! Overlap
+
+@param b1 The first body.
+@param b2 The second body.
+
+@return bool true if the two oriented boxes overlap.
 
-        auto aabb1{ GetAABBBody(rb1) };
-        auto aabb2{ GetAABBBody(rb2) };
-        //////trivial reject
-        if (!CheckAABBDiscrete(aabb1.first, aabb1.second, aabb2.first, aabb2.second)) {
-            //std::cout << "reject\n";
-            return Arbiter{};
+Separating axis test on the 4 face normals, no contact points. Used for
+triggers, which do not need a manifold.
+*/
+
+    bool Overlap(RigidBody const& b1, RigidBody const& b2) {
+        Vec2 cs1{ b1.GetRotationCosSin() }, cs2{ b2.GetRotationCosSin() };
+        Vec2 axes[4]{
+            cs1, Vec2{ -cs1.y, cs1.x },
+            cs2, Vec2{ -cs2.y, cs2.x }
+        };
+        Vec2 h1{ b1.dimension * .5f }, h2{ b2.dimension * .5f };
+        Vec2 d{ b2.position - b1.position };
+        for (auto const& axis : axes) {
+            float r1{ h1.x * fabs(dot(axes[0], axis)) + h1.y * fabs(dot(axes[1], axis)) };
+            float r2{ h2.x * fabs(dot(axes[2], axis)) + h2.y * fabs(dot(axes[3], axis)) };
+            if (fabs(dot(d, axis)) > r1 + r2) return false;
         }
+        return true;
+    }
+    /*  _________________________________________________________________________ */
+/*! Overlap
 
-        Arbiter result {};
+@param b1 The first body.
+@param c1 The collider of the first body.
+@param b2 The second body.
+@param c2 The collider of the second body.
 
-        result.b1 = b1;
-        result.b2 = b2;
+@return bool true if the two shapes overlap.
 
-        result.combinedFriction = sqrtf(rb1.friction * rb2.friction);
-        result.contactsCount = Collide(result.contacts, rb1, rb2);
+Box pairs use the separating axis test, other shapes go through the
+narrowphase table and only look at the contact count.
+*/
 
-        return result;
+    bool Overlap(RigidBody const& b1, BoxCollider const& c1, RigidBody const& b2, BoxCollider const& c2) {
+        if (c1.shape == ColliderShape::BOX && c2.shape == ColliderShape::BOX) return Overlap(b1, b2);
+        Contact contacts[MAX_CONTACT_POINTS];
+        return CollideShapes(contacts, b1, c1, b2, c2) > 0;
     }
     /*  _________________________________________________________________________ */
 /*! CollisionSystem::Init
@@ -459,6 +545,128 @@ Initializes the CollisionSystem, setting up the Quadtree and other necessary com
         gCoordinator = Coordinator::GetInstance();
         using namespace DataMgmt;
         mQuadtree = DataMgmt::Quadtree<Entity>{ 0, Rect(Vec2(static_cast<float>(-WORLD_LIMIT_X), static_cast<float>(-WORLD_LIMIT_Y)), Vec2(static_cast<float>(WORLD_LIMIT_X), static_cast<float>(WORLD_LIMIT_Y)))};
+        mAABBCache.resize(MAX_ENTITIES);
+        mFilterCache.resize(MAX_ENTITIES);
+        mBodyCache.resize(MAX_ENTITIES);
+        mTerrainRectOf.assign(MAX_ENTITIES, NO_TERRAIN_RECT);
+    }
+    /*  _________________________________________________________________________ */
+/*! CollisionSystem::BakeTerrain
+
+@return none.
+
+Collects every static, unrotated, solid box in the STATIC category and bakes
+them into the terrain grid. Those tiles leave the quadtree and are only
+found through the grid from then on, so they cost nothing per step. Each
+merged rect is stood in for by its lowest tile entity, which is the entity
+contact events and arbiters report. The terrain is not updated if a tile is
+moved afterwards, call this again instead. Destroyed tiles are picked up on
+their own.
+*/
+
+    void CollisionSystem::BakeTerrain() {
+        std::fill(mTerrainRectOf.begin(), mTerrainRectOf.end(), NO_TERRAIN_RECT);
+        std::vector<TerrainTile> tiles;
+        for (auto const& e : mEntities) {
+            auto const& rb{ gCoordinator->GetComponent<RigidBody>(e) };
+            auto const& collider{ gCoordinator->GetComponent<BoxCollider>(e) };
+            if (!rb.IsStatic() || rb.isBullet || rb.rotation != 0.f) continue;
+            if (collider.shape != ColliderShape::BOX || collider.isTrigger || !(collider.category & CollisionLayer::STATIC)) continue;
+            Vec2 h{ rb.dimension * .5f };
+            tiles.emplace_back(TerrainTile{ rb.position - h, rb.position + h, rb.friction, collider.category, collider.mask, e });
+        }
+        mTerrain.Build(std::move(tiles), TERRAIN_CELL_SIZE);
+        mTerrainTileCount = mTerrain.TileCount();
+
+        mTerrainBodies.clear();
+        for (uint32_t r{}; r < mTerrain.RectCount(); ++r) {
+            TerrainRect const& rect{ mTerrain.GetRect(r) };
+            for (uint32_t i{ rect.firstTile }; i < rect.firstTile + rect.tileCount; ++i) {
+                TerrainTile const& tile{ mTerrain.GetTile(i) };
+                mTerrainRectOf[tile.entity] = r;
+                mAABBCache[tile.entity] = { tile.min, tile.max };
+                mFilterCache[tile.entity] = ColliderFilter{ tile.category, tile.mask, true, false };
+            }
+
+            RigidBody body{ (rect.min + rect.max) * .5f, 0.f, 0.f, rect.max - rect.min };
+            body.friction = rect.friction;
+            mTerrainBodies.emplace_back(body);
+            mBodyCache[rect.entity] = NarrowBody{ body.position, body.dimension * .5f, Mat22{ 1.f, 0.f, 0.f, 1.f }, rect.friction, ColliderShape::BOX, 0.f };
+        }
+    }
+    /*  _________________________________________________________________________ */
+/*! CollisionSystem::GetBody
+
+@param e The entity.
+
+@return RigidBody const& The body the kernels should see, the whole merged
+rect for terrain tiles.
+*/
+
+    RigidBody const& CollisionSystem::GetBody(Entity e) const {
+        uint32_t r{ mTerrainRectOf[e] };
+        return r == NO_TERRAIN_RECT ? gCoordinator->GetComponent<RigidBody>(e) : mTerrainBodies[r];
+    }
+    /*  _________________________________________________________________________ */
+/*! CollisionSystem::UpdateAABBCache
+
+@param dt The time step the bodies are about to be moved by.
+
+@return none.
+
+Computes the aabb of every entity once so the quadtree insert, the
+broadphase and region queries do not redo the corner transforms, and
+the pair filter and narrowphase data so neither looks up components.
+The rotation is built once here and reused for the aabb and every pair the
+body is in, and only for bodies whose position, rotation or size changed
+since the last call. Bullets get the bounds swept over their motion this step so
+pairs they will pass through are still found. Baked terrain keeps the
+data written by BakeTerrain, the terrain is rebaked if any of it was
+destroyed.
+*/
+
+    void CollisionSystem::UpdateAABBCache(float dt) {
+        mDynamicEntities.clear();
+        size_t terrainTiles{};
+        for (auto const& e : mEntities) {
+            if (mTerrainRectOf[e] != NO_TERRAIN_RECT) {
+                ++terrainTiles;
+                continue;
+            }
+            mDynamicEntities.emplace_back(e);
+            auto& rb{ gCoordinator->GetComponent<RigidBody>(e) };
+            auto const& collider{ gCoordinator->GetComponent<BoxCollider>(e) };
+            //rotation set outside the step, refresh it once here for the whole frame
+            if (rb.rotation != rb.cachedRotation) rb.CacheRotation();
+            NarrowBody& body{ mBodyCache[e] };
+            body.friction = rb.friction;
+            mFilterCache[e] = ColliderFilter{ collider.category, collider.mask, rb.IsStatic(), collider.isTrigger };
+
+            //the box only changes when the body moved or changed shape, bullets also depend on their velocity
+            Vec2 halfExtents{ rb.dimension * .5f };
+            if (!rb.isBullet && body.position == rb.position && body.angle == rb.rotation && body.halfExtents == halfExtents
+                && body.shape == collider.shape) {
+                continue;
+            }
+            body.shape = collider.shape;
+            body.position = rb.position;
+            body.halfExtents = halfExtents;
+            body.angle = rb.rotation;
+            body.rotation = Mat22FromBody(rb);
+
+            Vec2 extents{ GetAABBExtents(body.rotation, body.halfExtents, body.shape) };
+            std::pair<Vec2, Vec2> aabb{ rb.position - extents, rb.position + extents };
+            if (rb.isBullet) {
+                Vec2 motion{ rb.velocity * dt };
+                aabb.first = Vec2{ std::min(aabb.first.x, aabb.first.x + motion.x), std::min(aabb.first.y, aabb.first.y + motion.y) };
+                aabb.second = Vec2{ std::max(aabb.second.x, aabb.second.x + motion.x), std::max(aabb.second.y, aabb.second.y + motion.y) };
+            }
+            mAABBCache[e] = aabb;
+        }
+        if (terrainTiles != mTerrainTileCount) {
+            BakeTerrain();
+            UpdateAABBCache(dt);
+        }
     }
     /*  _________________________________________________________________________ */
 /*! CollisionSystem::Update
@@ -467,11 +675,13 @@ Initializes the CollisionSystem, setting up the Quadtree and other necessary com
 
 @return none.
 
-Updates the CollisionSystem, checking for collisions between entities and sending collision events.
+Updates the CollisionSystem. The broadphase collects the candidate pairs of
+every quadtree leaf and of every body against the baked terrain, then the
+narrowphase runs once over the whole list and fills the arbiter buffer for
+the solver. The time of each half is kept in the profile.
 */
 
     void CollisionSystem::Update(float dt) {
-        UNREFERENCED_PARAMETER(dt);
         //for (auto const& entity : mEntities) {
         //	auto& collider = gCoordinator->GetComponent<BoxCollider>(entity);
         //	auto& rigidBody = gCoordinator->GetComponent<RigidBody>(entity);
@@ -479,12 +689,13 @@ Updates the CollisionSystem, checking for collisions between entities and sendin
 
         //}
 
-        mQuadtree.Update(mEntities, [](Entity const& e, DataMgmt::Rect const& r) {
-            auto const& rigidBody{ Coordinator::GetInstance()->GetComponent<RigidBody>(e) };
-            
+        auto start{ std::chrono::high_resolution_clock::now() };
+        UpdateAABBCache(dt);
+        mPairs.clear();
+        mQuadtree.Update(mDynamicEntities, [this](Entity const& e, DataMgmt::Rect const& r) {
             //todo update the position based on rotated box not aabb
             //todo substep checking
-            auto aabb = GetAABBBody(rigidBody);
+            auto const& aabb{ mAABBCache[e] };
             Vec2 rmin = r.GetMin();
             Vec2 rmax = r.GetMax();
             //basic aabb check
@@ -492,25 +703,256 @@ Updates the CollisionSystem, checking for collisions between entities and sendin
         });
         std::vector<std::vector<Entity>> entity2dVec;
         mQuadtree.Get(entity2dVec);
-        //std::cout << entity2dVec.size() << std::endl;
         //calculate each list of entities in each quad
         for (auto const& entityVec : entity2dVec) {
-            for (int i{}; i < entityVec.size(); ++i) {
-                for (int j{i + 1}; j < entityVec.size(); ++j) {
-                    //if (entityVec[i] == entityVec[j]) continue;
-                    Arbiter arbiter = Collide(entityVec[i], entityVec[j]);
-                    ArbiterKey arbiterKey{ entityVec[i], entityVec[j] };
-                    uint64_t hashTableKey = murmur64((void*)&arbiterKey, sizeof(ArbiterKey));
-
-                    if (arbiter.contactsCount > 0) {
-                        Event event{ Events::Physics::COLLISION };
-                        event.SetParam(Events::Physics::Collision::COLLIDED, ArbiterPair {hashTableKey, arbiter});
-                        gCoordinator->SendEvent(event);
-
+            //pack the leaf into soa so each body is tested against the rest 4/8 at a time
+            mBatch.Clear();
+            for (auto const& e : entityVec) mBatch.Push(mAABBCache[e].first, mAABBCache[e].second);
+            mHitMask.resize(AABBMaskWords(entityVec.size()));
+
+            for (size_t i{}; i < entityVec.size(); ++i) {
+                size_t first{ i + 1 }, count{ entityVec.size() - first };
+                auto const& aabb{ mAABBCache[entityVec[i]] };
+                if (!mFilterCache[entityVec[i]].mask) continue;
+                if (!OverlapBatch(aabb.first, aabb.second, mBatch, first, count, mHitMask.data())) continue;
+
+                for (size_t w{}; w < AABBMaskWords(count); ++w) {
+                    for (uint32_t bits{ mHitMask[w] }; bits; bits &= bits - 1) {
+                        size_t j{ first + w * 32 + std::countr_zero(bits) };
+                        if (!ShouldCollide(mFilterCache[entityVec[i]], mFilterCache[entityVec[j]])) continue;
+                        Entity a{ entityVec[i] }, b{ entityVec[j] };
+                        mPairs.emplace_back((static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b));
                     }
+                }
+            }
+        }
+        //terrain is not in the tree, each moving body looks itself up in the grid
+        for (auto const& e : mDynamicEntities) {
+            ColliderFilter const& filter{ mFilterCache[e] };
+            if (!filter.mask || filter.isStatic) continue;
+            mTerrain.Query(mAABBCache[e].first, mAABBCache[e].second, [&](size_t r) {
+                Entity other{ mTerrain.GetRect(r).entity };
+                if (!ShouldCollide(filter, mFilterCache[other])) return;
+                mPairs.emplace_back((static_cast<uint64_t>(std::min(e, other)) << 32) | std::max(e, other));
+            });
+        }
+        //a pair spanning several leaves is found once per leaf
+        std::sort(mPairs.begin(), mPairs.end());
+        mPairs.erase(std::unique(mPairs.begin(), mPairs.end()), mPairs.end());
+        auto broadphaseEnd{ std::chrono::high_resolution_clock::now() };
+
+        RunNarrowphase();
+        DispatchContactChanges();
+        auto narrowphaseEnd{ std::chrono::high_resolution_clock::now() };
+        mProfile.broadphaseNs = std::chrono::duration_cast<std::chrono::nanoseconds>(broadphaseEnd - start).count();
+        mProfile.narrowphaseNs = std::chrono::duration_cast<std::chrono::nanoseconds>(narrowphaseEnd - broadphaseEnd).count();
+    }
+    /*  _________________________________________________________________________ */
+/*! CollisionSystem::RunNarrowphase
 
+@return none.
+
+Turns the pair list into arbiters. Box pairs are packed into soa blocks and
+go through the face test 4 at a time, only the survivors are clipped, using
+the rotations cached per body. Other shape pairs use the shape table and
+triggers only test for overlap. The arbiters are written in pair order.
+*/
 
+    void CollisionSystem::RunNarrowphase() {
+        mArbiters.clear();
+
+        mBoxPairs.Clear();
+        for (auto const& key : mPairs) {
+            Entity a{ static_cast<Entity>(key >> 32) }, b{ static_cast<Entity>(key & 0xFFFFFFFFu) };
+            NarrowBody const& b1{ mBodyCache[a] };
+            NarrowBody const& b2{ mBodyCache[b] };
+            if (b1.shape != ColliderShape::BOX || b2.shape != ColliderShape::BOX) continue;
+            if (mFilterCache[a].isTrigger || mFilterCache[b].isTrigger) continue;
+            mBoxPairs.Push(b2.position - b1.position, b1.halfExtents, b1.rotation, b2.halfExtents, b2.rotation);
+        }
+        mBoxMask.resize(AABBMaskWords(mBoxPairs.Size()));
+        BoxFaceTestBatch(mBoxPairs, mBoxMask.data());
+
+        size_t boxIndex{};
+        for (auto const& key : mPairs) {
+            Entity a{ static_cast<Entity>(key >> 32) }, b{ static_cast<Entity>(key & 0xFFFFFFFFu) };
+            NarrowBody const& b1{ mBodyCache[a] };
+            NarrowBody const& b2{ mBodyCache[b] };
+
+            //triggers only need to know if they overlap, no arbiter for the solver
+            if (mFilterCache[a].isTrigger || mFilterCache[b].isTrigger) {
+                if (Overlap(GetBody(a), gCoordinator->GetComponent<BoxCollider>(a),
+                    GetBody(b), gCoordinator->GetComponent<BoxCollider>(b))) {
+                    mCurrPairs.emplace_back(ContactPair{ key, true });
                 }
+                continue;
+            }
+
+            Arbiter arbiter{};
+            if (b1.shape == ColliderShape::BOX && b2.shape == ColliderShape::BOX) {
+                size_t k{ boxIndex++ };
+                if (!(mBoxMask[k >> 5] & (1u << (k & 31)))) continue;
+                arbiter.contactsCount = CollideOBB(arbiter.contacts, b1.position, b1.halfExtents, b1.rotation,
+                    b2.position, b2.halfExtents, b2.rotation);
+            }
+            else {
+                arbiter.contactsCount = CollideShapes(arbiter.contacts,
+                    GetBody(a), gCoordinator->GetComponent<BoxCollider>(a),
+                    GetBody(b), gCoordinator->GetComponent<BoxCollider>(b));
+            }
+            if (!arbiter.contactsCount) continue;
+
+            arbiter.b1 = a;
+            arbiter.b2 = b;
+            arbiter.combinedFriction = sqrtf(b1.friction * b2.friction);
+            mArbiters.emplace_back(arbiter);
+            mCurrPairs.emplace_back(ContactPair{ key, false });
+
+            //every contact of a pair shares the normal
+            auto& rb1{ gCoordinator->GetComponent<RigidBody>(a) };
+            if (!rb1.isGrounded) {
+                rb1.isGrounded = (arbiter.contacts[0].normal.y < 0.0f);
+            }
+        }
+    }
+    /*  _________________________________________________________________________ */
+/*! CollisionSystem::DispatchContactChanges
+
+@return none.
+
+Diffs the pairs touching this step against the last step and only sends
+the begin and end events. Pairs touching in both steps send nothing.
+*/
+
+    void CollisionSystem::DispatchContactChanges() {
+        //already in key order since the pairs were
+
+        auto send = [](EventId id, uint64_t key) {
+            Event event{ id };
+            event.SetParam(Events::Physics::Pair::ENTITIES,
+                std::pair<Entity, Entity>{ static_cast<Entity>(key >> 32), static_cast<Entity>(key & 0xFFFFFFFFu) });
+            Coordinator::GetInstance()->SendEvent(event);
+        };
+
+        auto curr{ mCurrPairs.begin() }, prev{ mPrevPairs.begin() };
+        while (curr != mCurrPairs.end() || prev != mPrevPairs.end()) {
+            if (prev == mPrevPairs.end() || (curr != mCurrPairs.end() && curr->key < prev->key)) {
+                send(curr->isTrigger ? Events::Physics::TRIGGER_BEGIN : Events::Physics::CONTACT_BEGIN, curr->key);
+                ++curr;
+            }
+            else if (curr == mCurrPairs.end() || prev->key < curr->key) {
+                send(prev->isTrigger ? Events::Physics::TRIGGER_END : Events::Physics::CONTACT_END, prev->key);
+                ++prev;
+            }
+            else {
+                ++curr;
+                ++prev;
+            }
+        }
+
+        std::swap(mPrevPairs, mCurrPairs);
+        mCurrPairs.clear();
+    }
+    /*  _________________________________________________________________________ */
+/*! CollisionSystem::IsTouching
+
+@param a The first entity.
+@param b The second entity.
+
+@return bool true if the pair was touching (or overlapping, for triggers)
+in the last Update. This is the "stay" state, no event is sent for it.
+*/
+
+    bool CollisionSystem::IsTouching(Entity a, Entity b) const {
+        ContactPair pair{ (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b) };
+        return std::binary_search(mPrevPairs.begin(), mPrevPairs.end(), pair);
+    }
+    /*  _________________________________________________________________________ */
+/*! CollisionSystem::SaveState
+
+@param pairs Filled with the pairs touching in the last Update.
+
+@return none.
+*/
+
+    void CollisionSystem::SaveState(std::vector<ContactPair>& pairs) const {
+        pairs.assign(mPrevPairs.begin(), mPrevPairs.end());
+    }
+    /*  _________________________________________________________________________ */
+/*! CollisionSystem::RestoreState
+
+@param pairs Touching pairs from SaveState.
+
+@return none.
+
+The touching pairs decide which begin and end events the next Update
+sends, so restoring them keeps the events of a replay the same as the
+first run. Everything else, the arbiters included, is rebuilt from the
+bodies every Update, so it is not saved.
+*/
+
+    void CollisionSystem::RestoreState(std::vector<ContactPair> const& pairs) {
+        mPrevPairs.assign(pairs.begin(), pairs.end());
+    }
+    /*  _________________________________________________________________________ */
+/*! CollisionSystem::GetTouching
+
+@param e The entity.
+@param out Filled with every entity touching e in the last Update.
+
+@return none.
+*/
+
+    void CollisionSystem::GetTouching(Entity e, std::vector<Entity>& out) const {
+        out.clear();
+        for (auto const& pair : mPrevPairs) {
+            Entity a{ static_cast<Entity>(pair.key >> 32) }, b{ static_cast<Entity>(pair.key & 0xFFFFFFFFu) };
+            if (a == e) out.emplace_back(b);
+            else if (b == e) out.emplace_back(a);
+        }
+    }
+    /*  _________________________________________________________________________ */
+/*! CollisionSystem::QueryAABB
+
+@param min The minimum corner of the query region.
+@param max The maximum corner of the query region.
+@param out Filled with every entity whose aabb overlaps the region.
+
+@return none.
+
+Region query using the quadtree built in the last Update. Candidates from
+the overlapping leaves are deduped and then filtered with the batch
+overlap kernel. Terrain tiles come from the baked grid. Entities destroyed
+since the last Update are skipped like in the other queries.
+*/
+
+    void CollisionSystem::QueryAABB(Vec2 const& min, Vec2 const& max, std::vector<Entity>& out) {
+        out.clear();
+        mTerrain.Query(min, max, [&](size_t r) {
+            TerrainRect const& rect{ mTerrain.GetRect(r) };
+            for (uint32_t i{ rect.firstTile }; i < rect.firstTile + rect.tileCount; ++i) {
+                TerrainTile const& tile{ mTerrain.GetTile(i) };
+                if (mEntities.find(tile.entity) == mEntities.end()) continue;
+                if (min.x < tile.max.x && max.x > tile.min.x && min.y < tile.max.y && max.y > tile.min.y) out.emplace_back(tile.entity);
+            }
+        });
+
+        mCandidates.clear();
+        mQuadtree.Retrieve(mCandidates, DataMgmt::Rect{ min, max });
+        std::sort(mCandidates.begin(), mCandidates.end());
+        mCandidates.erase(std::unique(mCandidates.begin(), mCandidates.end()), mCandidates.end());
+        mCandidates.erase(std::remove_if(mCandidates.begin(), mCandidates.end(), [&](Entity e) {
+            return mEntities.find(e) == mEntities.end();
+        }), mCandidates.end());
+
+        mBatch.Clear();
+        for (auto const& e : mCandidates) mBatch.Push(mAABBCache[e].first, mAABBCache[e].second);
+        mHitMask.resize(AABBMaskWords(mCandidates.size()));
+        if (!OverlapBatch(min, max, mBatch, 0, mCandidates.size(), mHitMask.data())) return;
+
+        for (size_t w{}; w < mHitMask.size(); ++w) {
+            for (uint32_t bits{ mHitMask[w] }; bits; bits &= bits - 1) {
+                out.emplace_back(mCandidates[w * 32 + std::countr_zero(bits)]);
             }
         }
     }
@@ -531,7 +973,7 @@ Debugs the CollisionSystem, drawing AABBs and other debug information.
         for (auto const& e : mEntities) {
             auto const& rb{ Coordinator::GetInstance()->GetComponent<RigidBody>(e) };
 
-            auto aabb{ GetAABBBody(rb) };
+            auto aabb{ GetAABBBody(rb, Coordinator::GetInstance()->GetComponent<BoxCollider>(e).shape) };
             auto scale{ aabb.second - aabb.first };
             Vec2 pos{ aabb.first + scale / 2.f };
             Vec2 p1{ rb.position + rb.velocity };
@@ -541,4 +983,253 @@ Debugs the CollisionSystem, drawing AABBs and other debug information.
         //Renderer::RenderSceneEnd();
 
     }
+    /*  _________________________________________________________________________ */
+/*! RayBody
+
+@param rb The body to test.
+@param origin Start of the segment.
+@param dir Segment direction, the end point is origin + dir.
+@param t Fraction along the segment where the ray enters the box.
+@param normal World space normal of the face the ray enters through.
+
+@return bool true if the segment enters the box. A segment starting inside
+the box does not hit it.
+
+Slab test done in the body's local space so rotated boxes are exact.
+*/
+
+    bool RayBody(RigidBody const& rb, Vec2 const& origin, Vec2 const& dir, float& t, Vec2& normal) {
+        Vec2 cs{ rb.GetRotationCosSin() };
+        float c{ cs.x }, s{ cs.y };
+        Vec2 rel{ origin - rb.position };
+        Vec2 lo{ c * rel.x + s * rel.y, -s * rel.x + c * rel.y };
+        Vec2 ld{ c * dir.x + s * dir.y, -s * dir.x + c * dir.y };
+        Vec2 h{ rb.dimension * .5f };
+
+        float t0{ -FLOAT_MAX }, t1{ FLOAT_MAX };
+        int axis{ -1 };
+        for (int i{}; i < 2; ++i) {
+            if (ld[i] == 0.f) {
+                if (lo[i] < -h[i] || lo[i] > h[i]) return false;
+                continue;
+            }
+            float inv{ 1.f / ld[i] };
+            float tNear{ (-h[i] - lo[i]) * inv }, tFar{ (h[i] - lo[i]) * inv };
+            if (tNear > tFar) std::swap(tNear, tFar);
+            if (tNear > t0) { t0 = tNear; axis = i; }
+            t1 = std::min(t1, tFar);
+            if (t0 > t1) return false;
+        }
+        if (axis < 0 || t0 < 0.f || t0 > 1.f) return false;
+
+        Vec2 ln{};
+        ln[axis] = ld[axis] > 0.f ? -1.f : 1.f;
+        normal = Vec2{ c * ln.x - s * ln.y, s * ln.x + c * ln.y };
+        t = t0;
+        return true;
+    }
+    /*  _________________________________________________________________________ */
+/*! DistanceSqBody
+
+@param rb The body to measure against.
+@param p The point.
+
+@return float The squared distance from p to the closest point on the box,
+0 if p is inside.
+*/
+
+    float DistanceSqBody(RigidBody const& rb, Vec2 const& p) {
+        Vec2 cs{ rb.GetRotationCosSin() };
+        float c{ cs.x }, s{ cs.y };
+        Vec2 rel{ p - rb.position };
+        Vec2 lp{ c * rel.x + s * rel.y, -s * rel.x + c * rel.y };
+        Vec2 h{ rb.dimension * .5f };
+        Vec2 d{ lp.x - std::clamp(lp.x, -h.x, h.x), lp.y - std::clamp(lp.y, -h.y, h.y) };
+        return dot(d, d);
+    }
+    /*  _________________________________________________________________________ */
+/*! CollisionSystem::QueryRadius
+
+@param center The center of the query circle.
+@param radius The radius of the query circle.
+@param out Filled with every entity whose box touches the circle, nearest
+first.
+
+@return none.
+
+Gathers candidates with QueryAABB on the bounding square of the circle and
+keeps the boxes within radius of the center.
+*/
+
+    void CollisionSystem::QueryRadius(Vec2 const& center, float radius, std::vector<Entity>& out) {
+        out.clear();
+        QueryAABB(center - radius, center + radius, mQueryResult);
+
+        std::vector<std::pair<float, Entity>> sorted;
+        sorted.reserve(mQueryResult.size());
+        for (auto const& e : mQueryResult) {
+            //the tree is from the last Update, skip anything destroyed since
+            if (mEntities.find(e) == mEntities.end()) continue;
+            float distSq{ DistanceSqBody(gCoordinator->GetComponent<RigidBody>(e), center) };
+            if (distSq <= radius * radius) sorted.emplace_back(distSq, e);
+        }
+        std::sort(sorted.begin(), sorted.end());
+        for (auto const& [distSq, e] : sorted) out.emplace_back(e);
+    }
+    /*  _________________________________________________________________________ */
+/*! CollisionSystem::RaycastLeaves
+
+@param origin Start of the segment.
+@param end End of the segment.
+@param firstOnly Stop at the closest hit instead of gathering every hit.
+@param hits Filled with the hits, unsorted and possibly repeated when an
+entity spans several leaves.
+
+@return none.
+
+Walks the quadtree leaves along the segment front to back. With firstOnly
+the walk is clipped to the closest hit so far, so leaves behind it are
+never visited. The terrain tiles under what is left of the segment are
+tested last.
+*/
+
+    void CollisionSystem::RaycastLeaves(Vec2 const& origin, Vec2 const& end, bool firstOnly, std::vector<RaycastHit>& hits) {
+        hits.clear();
+        Vec2 dir{ end - origin };
+        float tMax{ 1.f };
+        RaycastHit best{};
+        best.fraction = FLOAT_MAX;
+
+        mQuadtree.Raycast(origin, dir, tMax, [&](std::vector<Entity> const& leaf, float& leafTMax) {
+            for (auto const& e : leaf) {
+                if (mEntities.find(e) == mEntities.end()) continue;
+                //cheap reject against the cached aabb before the exact box test
+                DataMgmt::Rect bounds{ mAABBCache[e].first, mAABBCache[e].second };
+                float tEnter{};
+                if (!bounds.IntersectRay(origin, dir, leafTMax, tEnter)) continue;
+
+                RaycastHit hit{};
+                if (!RayBody(gCoordinator->GetComponent<RigidBody>(e), origin, dir, hit.fraction, hit.normal)) continue;
+                if (hit.fraction > leafTMax) continue;
+                hit.entity = e;
+                hit.point = origin + dir * hit.fraction;
+
+                if (!firstOnly) hits.emplace_back(hit);
+                else if (hit.fraction < best.fraction) {
+                    best = hit;
+                    leafTMax = hit.fraction;
+                }
+            }
+        });
+
+        Vec2 reach{ origin + dir * std::min(best.fraction, tMax) };
+        Vec2 lo{ std::min(origin.x, reach.x), std::min(origin.y, reach.y) };
+        Vec2 hi{ std::max(origin.x, reach.x), std::max(origin.y, reach.y) };
+        mTerrain.Query(lo, hi, [&](size_t r) {
+            TerrainRect const& rect{ mTerrain.GetRect(r) };
+            for (uint32_t i{ rect.firstTile }; i < rect.firstTile + rect.tileCount; ++i) {
+                TerrainTile const& tile{ mTerrain.GetTile(i) };
+                if (mEntities.find(tile.entity) == mEntities.end()) continue;
+                float tEnter{}, rayTMax{ firstOnly ? std::min(best.fraction, tMax) : tMax };
+                if (!DataMgmt::Rect{ tile.min, tile.max }.IntersectRay(origin, dir, rayTMax, tEnter)) continue;
+
+                RaycastHit hit{};
+                if (!RayBody(gCoordinator->GetComponent<RigidBody>(tile.entity), origin, dir, hit.fraction, hit.normal)) continue;
+                if (hit.fraction > rayTMax) continue;
+                hit.entity = tile.entity;
+                hit.point = origin + dir * hit.fraction;
+
+                if (!firstOnly) hits.emplace_back(hit);
+                else if (hit.fraction < best.fraction) best = hit;
+            }
+        });
+        if (firstOnly && best.fraction <= 1.f) hits.emplace_back(best);
+    }
+    /*  _________________________________________________________________________ */
+/*! CollisionSystem::Raycast
+
+@param origin Start of the segment.
+@param end End of the segment.
+@param hit The closest hit, only written when something is hit.
+
+@return bool true if the segment hits any body. Bodies containing origin
+are ignored, so casting from inside the caster's own box works.
+*/
+
+    bool CollisionSystem::Raycast(Vec2 const& origin, Vec2 const& end, RaycastHit& hit) {
+        RaycastLeaves(origin, end, true, mRayHits);
+        if (mRayHits.empty()) return false;
+        hit = mRayHits.front();
+        return true;
+    }
+    /*  _________________________________________________________________________ */
+/*! CollisionSystem::RaycastAll
+
+@param origin Start of the segment.
+@param end End of the segment.
+@param hits Filled with every body hit, nearest first.
+
+@return size_t The number of bodies hit.
+*/
+
+    size_t CollisionSystem::RaycastAll(Vec2 const& origin, Vec2 const& end, std::vector<RaycastHit>& hits) {
+        RaycastLeaves(origin, end, false, hits);
+        std::sort(hits.begin(), hits.end(), [](RaycastHit const& a, RaycastHit const& b) {
+            return a.entity < b.entity;
+        });
+        hits.erase(std::unique(hits.begin(), hits.end(), [](RaycastHit const& a, RaycastHit const& b) {
+            return a.entity == b.entity;
+        }), hits.end());
+        std::sort(hits.begin(), hits.end(), [](RaycastHit const& a, RaycastHit const& b) {
+            return a.fraction < b.fraction;
+        });
+        return hits.size();
+    }
+    /*  _________________________________________________________________________ */
+/*! CollisionSystem::Sweep
+
+@param e The moving entity.
+@param motion How far the entity moves this step.
+@param hit The earliest impact, fraction is the time of impact along motion
+and normal faces against the motion.
+
+@return bool true if the entity would hit another collider before the end
+of the motion.
+
+Swept aabb time of impact against every non bullet, non trigger collider the motion
+passes over whose category and mask pass ShouldCollide with the entity.
+Colliders already overlapping the entity at the start are left to the
+discrete pass.
+*/
+
+    bool CollisionSystem::Sweep(Entity e, Vec2 const& motion, RaycastHit& hit) {
+        if (mEntities.find(e) == mEntities.end()) return false;
+        if (motion.x == 0.f && motion.y == 0.f) return false;
+
+        auto aabb{ GetAABBBody(gCoordinator->GetComponent<RigidBody>(e), gCoordinator->GetComponent<BoxCollider>(e).shape) };
+        CollisionRect rDynamic{ aabb.first, aabb.second - aabb.first };
+        Vec2 sweepMin{ std::min(aabb.first.x, aabb.first.x + motion.x), std::min(aabb.first.y, aabb.first.y + motion.y) };
+        Vec2 sweepMax{ std::max(aabb.second.x, aabb.second.x + motion.x), std::max(aabb.second.y, aabb.second.y + motion.y) };
+        QueryAABB(sweepMin, sweepMax, mQueryResult);
+
+        hit.fraction = FLOAT_MAX;
+        for (auto const& other : mQueryResult) {
+            if (other == e || mEntities.find(other) == mEntities.end()) continue;
+            if (gCoordinator->GetComponent<RigidBody>(other).isBullet || mFilterCache[other].isTrigger) continue;
+            if (!ShouldCollide(mFilterCache[e], mFilterCache[other])) continue;
+
+            auto const& bounds{ mAABBCache[other] };
+            CollisionRect rStatic{ bounds.first, bounds.second - bounds.first };
+            Vec2 point{}, normal{};
+            float toi{};
+            if (!CheckSweptAABB(rDynamic, motion, 1.f, rStatic, point, normal, toi)) continue;
+            if (toi < hit.fraction) {
+                hit.entity = other;
+                hit.fraction = toi;
+                hit.point = point;
+                hit.normal = normal;
+            }
+        }
+        return hit.fraction <= 1.f;
+    }
 }
@@ -50,6 +50,7 @@ void EditorControlSystem::Init()
 	::gCoordinator->AddComponent(
 		entity,
 		BoxCollider{
+			CollisionLayer::STATIC, CollisionLayer::ALL
 		});
 	::gCoordinator->AddComponent(
 		entity,
@@ -72,6 +73,7 @@ void EditorControlSystem::Init()
 	::gCoordinator->AddComponent(
 		entity,
 		BoxCollider{
+			CollisionLayer::STATIC, CollisionLayer::ALL
 		});
 	::gCoordinator->AddComponent(
 		entity,
@@ -94,6 +96,7 @@ void EditorControlSystem::Init()
 	::gCoordinator->AddComponent(
 		entity,
 		BoxCollider{
+			CollisionLayer::STATIC, CollisionLayer::ALL
 		});
 	::gCoordinator->AddComponent(
 		entity,
@@ -120,12 +123,15 @@ void EditorControlSystem::Init()
 	::gCoordinator->AddComponent(
 		player,
 		BoxCollider{
+			CollisionLayer::PLAYER, CollisionLayer::ALL
 		});
 	::gCoordinator->AddComponent(
 		player,
 		RigidBody{
 			Vec2(position), 0.f, 10.f, Vec2(scale, scale), false
 		});
+	//player can move fast enough to pass through the 5 unit walls in one step
+	::gCoordinator->GetComponent<RigidBody>(player).isBullet = true;
 	::gCoordinator->AddComponent(
 		player,
 		Transform{
@@ -48,7 +48,9 @@ namespace Serializer {
 	   @param name
 	   The name of the JSON file to load entities from.
 
-	   This function loads entities from a specified JSON file.
+	   This function loads entities from a specified JSON file. Joints are
+	   saved with the other body's index in the array, they are pointed at
+	   the entity loaded from that index once every entity exists.
 	*/
 	void EntitySerializationSystem::LoadEntities(std::string const& name) {
 		std::shared_ptr< Serializer::SerializationManager> sm{ Serializer::SerializationManager::GetInstance() };
@@ -56,15 +58,30 @@ namespace Serializer {
 		if (!sm->OpenJSON(name)) return;
 
 		if (!sm->At("Entities").IsArray()) return;
+		//entity loaded from each index of the array, JOINT_WORLD where nothing was
+		std::vector<Entity> loaded;
 		for (auto const& item : sm->At("Entities").GetArray()) {
-			if (!item.IsObject()) continue;
+			if (!item.IsObject()) {
+				loaded.push_back(JOINT_WORLD);
+				continue;
+			}
 			Entity entity{ gCoordinator->CreateEntity() };
+			loaded.push_back(entity);
 			for (auto itr = item.MemberBegin(); itr != item.MemberEnd(); ++itr) {
 				auto at{ gComponentSerializer.find(itr->name.GetString()) };
 				if (at == gComponentSerializer.end()) continue;
 				at->second(entity, itr->value);
 			}
 		}
+
+		for (auto const& entity : loaded) {
+			if (entity == JOINT_WORLD || !gCoordinator->HasComponent<Joint>(entity)) continue;
+			Joint& joint{ gCoordinator->GetComponent<Joint>(entity) };
+			if (joint.other == JOINT_WORLD) continue;
+			//an index with no entity joins the body to itself, which the joint system skips
+			bool isLoaded{ joint.other < loaded.size() && loaded[joint.other] != JOINT_WORLD };
+			joint.other = isLoaded ? loaded[joint.other] : entity;
+		}
 	}
 
 	/*  _________________________________________________________________________ */
@@ -75,15 +92,26 @@ namespace Serializer {
 
 	   This function writes the current state of entities to a specified JSON file.
 	   It serializes the entities and their components, then saves the data to the file.
+	   Entity ids are not kept across a reload, so a joint saves the other body as
+	   its index in the array instead.
 	*/
 	void EntitySerializationSystem::FlushEntities(std::string const& name) {
 		std::shared_ptr< Serializer::SerializationManager> sm{ Serializer::SerializationManager::GetInstance() };
 		sm->ClearJSON(name);
 		sm->SetObject(name);
+		std::unordered_map<Entity, unsigned int> indexOf;
+		for (auto const& entity : mEntities) indexOf.emplace(entity, static_cast<unsigned int>(indexOf.size()));
 		JSONObj entArr{ JSON_ARR_TYPE };
 		for (auto const& entity : mEntities) {
 			JSONObj obj{ JSON_OBJ_TYPE };
 			SerializeEntity(entity, obj);
+			if (obj.HasMember("Joint")) {
+				Entity other{ gCoordinator->GetComponent<Joint>(entity).other };
+				auto at{ indexOf.find(other) };
+				//a body that is not saved is written as the joint's own entity, it loads as a broken joint
+				unsigned int index{ other == JOINT_WORLD ? JOINT_WORLD : at != indexOf.end() ? at->second : indexOf[entity] };
+				obj["Joint"]["other"].SetUint(index);
+			}
 			sm->PushToArray(name, entArr, obj);
 		}
 		sm->InsertValue("Entities", entArr);
@@ -0,0 +1,298 @@
+/******************************************************************************/
+/*!
+\par        Image Engine
+\file       JointSystem.cpp
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief		distance, revolute and prismatic joints, solved by the physics
+			system alongside the contact arbiters
+
+			same sequential impulse scheme as the arbiters, position drift is
+			fed back as a velocity bias. unlike contacts the accumulated
+			impulses live on the component, so each step starts from the last
+			step's answer (warm starting) and chains and stacks of joints
+			settle in the 10 iterations.
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+			or disclosure of this file or its contents without the prior
+			written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+#include "../include/pch.hpp"
+
+#include "Systems/JointSystem.hpp"
+#include "Core/Coordinator.hpp"
+#include "Components/RigidBody.hpp"
+#include "Components/Joint.hpp"
+#include "Math/MathUtils.h"
+
+namespace {
+	std::shared_ptr<Coordinator> gCoordinator;
+	//fraction of the position error removed per step
+	constexpr float JOINT_BIAS_FACTOR{ .2f };
+	constexpr float EPSILON{ 1e-6f };
+
+	//by the body's cached sin and cos, like the contact solver
+	Vec2 Rotate(Vec2 const& v, RigidBody const& rb) {
+		Vec2 cs{ rb.GetRotationCosSin() };
+		return Vec2{ cs.x * v.x - cs.y * v.y, cs.y * v.x + cs.x * v.y };
+	}
+	//locked bodies never turn, same as in the arbiters
+	float InvInertia(RigidBody const& rb) { return rb.isLockRotation ? 0.f : rb.invInertia; }
+
+	/*  _________________________________________________________________________ */
+	/*! SetupRow
+
+	@param row The row to fill.
+	@param dir Linear direction of the constraint, zero for angular only.
+	@param armOther Moment arm on the other body.
+	@param armSelf Moment arm on this body.
+	@param other The other body.
+	@param self This body.
+
+	@return none.
+
+	Computes the effective mass, the row is disabled (mass 0) when neither
+	body can move along it.
+	*/
+	void SetupRow(JointRow& row, Vec2 const& dir, float armOther, float armSelf, RigidBody const& other, RigidBody const& self) {
+		row.dir = dir;
+		row.armOther = armOther;
+		row.armSelf = armSelf;
+		float k{ (other.invMass + self.invMass) * dot(dir, dir)
+			+ InvInertia(other) * armOther * armOther + InvInertia(self) * armSelf * armSelf };
+		row.mass = k > 0.f ? 1.f / k : 0.f;
+	}
+	float RowVelocity(JointRow const& row, RigidBody const& other, RigidBody const& self) {
+		return dot(row.dir, self.velocity - other.velocity) + row.armSelf * self.angularVelocity - row.armOther * other.angularVelocity;
+	}
+	void ApplyRow(JointRow const& row, RigidBody& other, RigidBody& self, float lambda) {
+		other.velocity -= row.dir * (lambda * other.invMass);
+		other.angularVelocity -= InvInertia(other) * row.armOther * lambda;
+		self.velocity += row.dir * (lambda * self.invMass);
+		self.angularVelocity += InvInertia(self) * row.armSelf * lambda;
+	}
+	/*  _________________________________________________________________________ */
+	/*! SolveRow
+
+	@param row The row to solve, its accumulated impulse is updated.
+	@param other The other body.
+	@param self This body.
+	@param target The velocity the row should end up at.
+	@param lo Lowest accumulated impulse.
+	@param hi Highest accumulated impulse.
+
+	@return none.
+	*/
+	void SolveRow(JointRow& row, RigidBody& other, RigidBody& self, float target,
+		float lo = -FLOAT_MAX, float hi = FLOAT_MAX) {
+		if (row.mass == 0.f) return;
+		float lambda{ row.mass * (target - RowVelocity(row, other, self)) };
+		float old{ row.impulse };
+		row.impulse = std::clamp(old + lambda, lo, hi);
+		ApplyRow(row, other, self, row.impulse - old);
+	}
+}
+
+namespace Physics {
+	/*  _________________________________________________________________________ */
+	/*! JointSystem::Init
+
+	@return none.
+	*/
+	void JointSystem::Init() {
+		gCoordinator = Coordinator::GetInstance();
+	}
+	/*  _________________________________________________________________________ */
+	/*! JointSystem::GetBodies
+
+	@param e The entity owning the joint.
+	@param joint The joint.
+	@param other Set to the other body, or the world.
+	@param self Set to the entity's body.
+
+	@return bool false if the other body no longer exists.
+	*/
+	bool JointSystem::GetBodies(Entity e, Joint const& joint, RigidBody*& other, RigidBody*& self) {
+		self = &gCoordinator->GetComponent<RigidBody>(e);
+		if (joint.other == JOINT_WORLD) {
+			other = &mWorldBody;
+			return true;
+		}
+		if (joint.other == e || !gCoordinator->HasComponent<RigidBody>(joint.other)) return false;
+		other = &gCoordinator->GetComponent<RigidBody>(joint.other);
+		return true;
+	}
+	/*  _________________________________________________________________________ */
+	/*! JointSystem::PreStep
+
+	@param invDt The inverse of the time step.
+
+	@return none.
+
+	Computes the anchors, effective masses and position biases of every
+	joint for this step and applies last step's impulses to warm start.
+	Called after the arbiter pre step, before the iterations.
+	*/
+	void JointSystem::PreStep(float invDt) {
+		mWorldBody = RigidBody{};
+		for (auto const& e : mEntities) {
+			auto& joint{ gCoordinator->GetComponent<Joint>(e) };
+			RigidBody* other{}, * self{};
+			joint.isActive = GetBodies(e, joint, other, self) && (other->invMass + self->invMass + InvInertia(*other) + InvInertia(*self)) > 0.f;
+			if (!joint.isActive) {
+				joint.pointImpulse = Vec2{};
+				joint.axial.impulse = joint.angular.impulse = joint.motor.impulse = 0.f;
+				continue;
+			}
+
+			bool isWorld{ joint.other == JOINT_WORLD };
+			joint.rOther = isWorld ? Vec2{} : Rotate(joint.otherAnchor, *other);
+			joint.rSelf = Rotate(joint.localAnchor, *self);
+			Vec2 pOther{ isWorld ? joint.otherAnchor : other->position + joint.rOther };
+			Vec2 pSelf{ self->position + joint.rSelf };
+			Vec2 d{ pSelf - pOther };
+			float iOther{ InvInertia(*other) }, iSelf{ InvInertia(*self) };
+
+			if (!joint.isReferenceSet) {
+				joint.referenceAngle = self->rotation - other->rotation;
+				if (joint.type == JointType::DISTANCE && joint.length <= 0.f) joint.length = length(d);
+				joint.isReferenceSet = true;
+			}
+			joint.motorMaxImpulse = joint.maxMotorForce / invDt;
+
+			switch (joint.type) {
+			case JointType::DISTANCE: {
+				float len{ length(d) };
+				Vec2 n{ len > EPSILON ? d * (1.f / len) : Vec2{ 0.f, 1.f } };
+				float error{ len - joint.length };
+				SetupRow(joint.axial, n, cross(joint.rOther, n), cross(joint.rSelf, n), *other, *self);
+				joint.axial.bias = -JOINT_BIAS_FACTOR * invDt * error;
+				//slack rope, nothing to hold
+				if (joint.isRope && error <= 0.f) {
+					joint.axial.mass = 0.f;
+					joint.axial.impulse = 0.f;
+				}
+				ApplyRow(joint.axial, *other, *self, joint.axial.impulse);
+				break;
+			}
+			case JointType::REVOLUTE: {
+				Vec2 rO{ joint.rOther }, rS{ joint.rSelf };
+				float mass{ other->invMass + self->invMass };
+				Mat22 k{ mass + iOther * rO.y * rO.y + iSelf * rS.y * rS.y, -iOther * rO.x * rO.y - iSelf * rS.x * rS.y,
+					-iOther * rO.x * rO.y - iSelf * rS.x * rS.y, mass + iOther * rO.x * rO.x + iSelf * rS.x * rS.x };
+				float det{ k.mMat[0][0] * k.mMat[1][1] - k.mMat[0][1] * k.mMat[1][0] };
+				if (det != 0.f) {
+					Mat22Inverse(joint.pointMass, k);
+				}
+				else {
+					joint.pointMass = Mat22{};
+					joint.pointImpulse = Vec2{};
+				}
+				joint.pointBias = d * (-JOINT_BIAS_FACTOR * invDt);
+				SetupRow(joint.motor, Vec2{}, 1.f, 1.f, *other, *self);
+
+				Vec2 p{ joint.pointImpulse };
+				other->velocity -= p * other->invMass;
+				other->angularVelocity -= iOther * cross(rO, p);
+				self->velocity += p * self->invMass;
+				self->angularVelocity += iSelf * cross(rS, p);
+				if (!joint.enableMotor) joint.motor.impulse = 0.f;
+				ApplyRow(joint.motor, *other, *self, joint.motor.impulse);
+				break;
+			}
+			case JointType::PRISMATIC: {
+				Vec2 axis{ normalized(joint.axis) };
+				if (!isWorld) axis = Rotate(axis, *other);
+				Vec2 perp{ -axis.y, axis.x };
+				//the other body's arm reaches to the anchor on this body
+				SetupRow(joint.axial, perp, cross(d + joint.rOther, perp), cross(joint.rSelf, perp), *other, *self);
+				joint.axial.bias = -JOINT_BIAS_FACTOR * invDt * dot(perp, d);
+				SetupRow(joint.angular, Vec2{}, 1.f, 1.f, *other, *self);
+				joint.angular.bias = -JOINT_BIAS_FACTOR * invDt * (self->rotation - other->rotation - joint.referenceAngle);
+				SetupRow(joint.motor, axis, cross(d + joint.rOther, axis), cross(joint.rSelf, axis), *other, *self);
+				if (!joint.enableMotor) joint.motor.impulse = 0.f;
+
+				ApplyRow(joint.axial, *other, *self, joint.axial.impulse);
+				ApplyRow(joint.angular, *other, *self, joint.angular.impulse);
+				ApplyRow(joint.motor, *other, *self, joint.motor.impulse);
+				break;
+			}
+			}
+		}
+	}
+	/*  _________________________________________________________________________ */
+	/*! JointSystem::ApplyImpulses
+
+	@return none.
+
+	One solver iteration over every joint, called once per iteration right
+	after the arbiters. Motors are solved first so the hard constraints get
+	the last word.
+	*/
+	void JointSystem::ApplyImpulses() {
+		for (auto const& e : mEntities) {
+			auto& joint{ gCoordinator->GetComponent<Joint>(e) };
+			if (!joint.isActive) continue;
+			RigidBody* other{}, * self{};
+			GetBodies(e, joint, other, self);
+
+			switch (joint.type) {
+			case JointType::DISTANCE:
+				if (joint.isRope) SolveRow(joint.axial, *other, *self, joint.axial.bias, -FLOAT_MAX, 0.f);
+				else SolveRow(joint.axial, *other, *self, joint.axial.bias);
+				break;
+			case JointType::REVOLUTE: {
+				if (joint.enableMotor) {
+					SolveRow(joint.motor, *other, *self, joint.motorSpeed, -joint.motorMaxImpulse, joint.motorMaxImpulse);
+				}
+				Vec2 rO{ joint.rOther }, rS{ joint.rSelf };
+				Vec2 dv{ self->velocity + cross(self->angularVelocity, rS) - other->velocity - cross(other->angularVelocity, rO) };
+				Vec2 p{ joint.pointMass * (joint.pointBias - dv) };
+				joint.pointImpulse += p;
+				other->velocity -= p * other->invMass;
+				other->angularVelocity -= InvInertia(*other) * cross(rO, p);
+				self->velocity += p * self->invMass;
+				self->angularVelocity += InvInertia(*self) * cross(rS, p);
+				break;
+			}
+			case JointType::PRISMATIC:
+				if (joint.enableMotor) {
+					SolveRow(joint.motor, *other, *self, joint.motorSpeed, -joint.motorMaxImpulse, joint.motorMaxImpulse);
+				}
+				SolveRow(joint.angular, *other, *self, joint.angular.bias);
+				SolveRow(joint.axial, *other, *self, joint.axial.bias);
+				break;
+			}
+		}
+	}
+	/*  _________________________________________________________________________ */
+	/*! JointSystem::SaveState
+
+	@param out Filled with a copy of every joint, solver state included.
+
+	@return none.
+	*/
+	void JointSystem::SaveState(std::vector<std::pair<Entity, Joint>>& out) const {
+		out.clear();
+		for (auto const& e : mEntities) out.emplace_back(e, gCoordinator->GetComponent<Joint>(e));
+	}
+	/*  _________________________________________________________________________ */
+	/*! JointSystem::RestoreState
+
+	@param joints Joints from SaveState.
+
+	@return none.
+
+	Puts the joints back with their accumulated impulses so the next step
+	warm starts exactly as it did the first time. Joints of entities that no
+	longer have one are skipped.
+	*/
+	void JointSystem::RestoreState(std::vector<std::pair<Entity, Joint>> const& joints) {
+		for (auto const& [e, joint] : joints) {
+			if (gCoordinator->HasComponent<Joint>(e)) gCoordinator->GetComponent<Joint>(e) = joint;
+		}
+	}
+}
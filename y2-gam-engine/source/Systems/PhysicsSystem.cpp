@@ -19,63 +19,21 @@
 #include "Components/Gravity.hpp"
 #include "Components/RigidBody.hpp"
 #include "Components/Transform.hpp"
+#include "Systems/CollisionSystem.hpp"
+#include "Systems/JointSystem.hpp"
 #include "Core/Coordinator.hpp"
 #include <Components/BoxCollider.hpp>
 #include <Core/Physics.hpp>
 #include <Core/Types.hpp>
 #include "Math/MathUtils.h"
+#include "Math/FastTrig.hpp"
+#include <bit>
 
 namespace {
 	std::shared_ptr<Coordinator> gCoordinator;
 }
 namespace Physics {
     /*  _________________________________________________________________________ */
-    /*! ArbiterMergeContacts
-
-    @param a The primary arbiter whose contacts might be updated.
-    @param toMerge The arbiter containing new contacts to be merged.
-
-    Merges contact points between two arbiters. This function checks if the new
-    contacts from `toMerge` already exist in `a`. If they do, it updates the
-    accumulated impulses; otherwise, it simply copies the new contact.
-    */
-
-    void ArbiterMergeContacts(Arbiter& a, Arbiter toMerge) {
-        Contact mergedContacts[2];
-
-        for (uint32_t i = 0; i < toMerge.contactsCount; i++) {
-            Contact& cNew{ toMerge.contacts[i] };
-            int k = -1;
-            for (uint32_t j = 0; j < a.contactsCount; j++) {
-                Contact& cOld = *(a.contacts + j);
-                if (cNew.feature.value == cOld.feature.value) {
-                    k = j;
-                    break;
-                }
-            }
-
-            if (k > -1) {
-                Contact& c{ mergedContacts[i] };
-                Contact& cOld{ a.contacts[k] };
-                c = cNew;
-
-                // Warm starting
-                c.accNormalImpulse = cOld.accNormalImpulse;
-                c.accTangentImpulse = cOld.accTangentImpulse;
-                c.accBiasedNormalImpulse = cOld.accBiasedNormalImpulse;
-            }
-            else {
-                mergedContacts[i] = toMerge.contacts[i];
-            }
-        }
-
-        for (uint32_t i = 0; i < toMerge.contactsCount; i++) {
-            a.contacts[i] = mergedContacts[i];
-        }
-
-        a.contactsCount = toMerge.contactsCount;
-    }
-    /*  _________________________________________________________________________ */
 /*! ArbiterPreStep
 
 @param a The arbiter to be prepared.
@@ -217,16 +175,12 @@ the impulse is applied, preventing the bodies from penetrating each other.
     /*  _________________________________________________________________________ */
 /*! PhysicsSystem::Init
 
-Initializes the physics system. Sets up an event listener for collision events
-and clears the arbiter table.
+Initializes the physics system.
 */
 
 	void PhysicsSystem::Init()
 	{
 		gCoordinator = Coordinator::GetInstance();
-        ::gCoordinator->AddEventListener(METHOD_LISTENER(Events::Physics::COLLISION, PhysicsSystem::CollisionListener));
-
-        mArbiterTable.clear();
 	}
 
     /*  _________________________________________________________________________ */
@@ -234,14 +188,13 @@ and clears the arbiter table.
 
 @param dt The time step for the current frame (not used in the current implementation).
 
-Prepares the physics system for the collision detection phase. Clears the
-arbiter table and resets the `isGrounded` flag for all rigid bodies.
+Prepares the physics system for the collision detection phase. Resets the
+`isGrounded` flag for all rigid bodies.
 */
 
     void PhysicsSystem::PreCollisionUpdate(float dt)
     {
         UNREFERENCED_PARAMETER(dt);
-        mArbiterTable.clear();
         for (auto const& entity : mEntities)
         {
             auto& rigidBody = gCoordinator->GetComponent<RigidBody>(entity);
@@ -256,10 +209,28 @@ arbiter table and resets the `isGrounded` flag for all rigid bodies.
 Updates the physics system after the collision detection phase. Integrates
 forces to update velocities, prepares for impulse resolution, iteratively
 applies impulses, and then integrates velocities again to update positions
-and rotations of the rigid bodies.
+and rotations of the rigid bodies. The arbiters are read straight from the
+collision system's buffer, already in ArbiterKey order, so the impulses are
+applied in the same order every run no matter how the broadphase found the
+pairs. Joints are prepared after the arbiters and solved after them in
+every iteration. The time of each stage is kept in the profile and the
+resulting state is saved into the history.
 */
 
 	void PhysicsSystem::PostCollisionUpdate(float dt) {
+        auto collisionSystem{ gCoordinator->GetSystem<Collision::CollisionSystem>() };
+        auto& arbiters{ collisionSystem->GetArbiters() };
+        auto jointSystem{ gCoordinator->GetSystem<JointSystem>() };
+        assert(std::is_sorted(arbiters.begin(), arbiters.end(), [](Arbiter const& lhs, Arbiter const& rhs) {
+            return ArbiterKey{ lhs.b1, lhs.b2 } < ArbiterKey{ rhs.b1, rhs.b2 };
+        }) && "Arbiters must be in key order for the solver to be deterministic.");
+
+        using ProfileClock = std::chrono::high_resolution_clock;
+        auto elapsedNs = [](ProfileClock::time_point from, ProfileClock::time_point to) {
+            return static_cast<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count());
+        };
+        auto start{ ProfileClock::now() };
+
         // Integrate forces
         float invDt{ 1.f / dt };
         for (auto const& entity : mEntities)
@@ -273,63 +244,209 @@ and rotations of the rigid bodies.
             rigidBody.angularVelocity += (rigidBody.torque * rigidBody.invInertia) * dt;
         }
 
+        auto forcesEnd{ ProfileClock::now() };
+
         // Perform pre-steps
-        // for (size_t i = 0; i < mArbiterTable.entries_count; i++) {
-          // for (size_t i = 0; i < mArbiterTable.size(); i++) {
-          // Arbiter *a = &mArbiterTable.entries[i].value;
-        for (auto& a : mArbiterTable) {
-            ArbiterPreStep(a.second, invDt);
+        for (auto& a : arbiters) {
+            ArbiterPreStep(a, invDt);
         }
+        if (jointSystem) jointSystem->PreStep(invDt);
+
+        auto prestepEnd{ ProfileClock::now() };
 
         // Perform iterations
         for (size_t i = 0; i < iterations; i++) {
-            // for (size_t ai = 0; ai < mArbiterTable.entries_count; ai++) {
-            //   Arbiter *a = &mArbiterTable.entries[ai].value;
-            //   ArbiterApplyImpulse(a);
-            // }
-            for (auto& a : mArbiterTable) {
-                ArbiterApplyImpulse(a.second);
+            for (auto& a : arbiters) {
+                ArbiterApplyImpulse(a);
             }
+            if (jointSystem) jointSystem->ApplyImpulses();
         }
 
-        // Integrate velocities
+        auto iterationsEnd{ ProfileClock::now() };
+
+        // Integrate velocities, bullets are swept so they stop at the first collider in their path
         for (auto const& entity : mEntities){
             auto& rigidBody = gCoordinator->GetComponent<RigidBody>(entity);
             auto& transform = gCoordinator->GetComponent<Transform>(entity);
 
-            rigidBody.position += rigidBody.velocity * dt;
-            rigidBody.rotation += rigidBody.angularVelocity * dt;
+            Vec2 motion{ rigidBody.velocity * dt };
+            Collision::RaycastHit hit{};
+            if (rigidBody.isBullet && collisionSystem->Sweep(entity, motion, hit)) {
+                //stop at the time of impact and drop the velocity into the surface,
+                //the discrete pass resolves the resting contact next step
+                rigidBody.position += motion * hit.fraction;
+                Vec2 normal{ (hit.normal.x == 0.f && hit.normal.y == 0.f) ? normalized(motion) * -1.f : hit.normal };
+                float normalVelocity{ dot(rigidBody.velocity, normal) };
+                if (normalVelocity < 0.f) rigidBody.velocity -= normal * normalVelocity;
+            }
+            else {
+                rigidBody.position += motion;
+            }
+            //locked bodies never turn, so their sin and cos never need refreshing
+            if (!rigidBody.isLockRotation) {
+                rigidBody.rotation += rigidBody.angularVelocity * dt;
+                if (rigidBody.rotation != rigidBody.cachedRotation) {
+                    mTurnedBodies.emplace_back(&rigidBody);
+                    mTurnedAngles.emplace_back(rigidBody.rotation);
+                }
+            }
+
+            //the body is the source of truth, the transform only follows it when they differ
+            //so bodies at rest leave their transform (and its cached matrix) alone
+            float degrees{ Degree(rigidBody.rotation) };
+            if (transform.position.x != rigidBody.position.x || transform.position.y != rigidBody.position.y
+                || transform.rotation.z != degrees) {
+                transform.position = { rigidBody.position.x, rigidBody.position.y, 0 };
+                transform.rotation = { 0, 0, degrees };
+            }
 
-            //change this soon
-            transform.position = {rigidBody.position.x,rigidBody.position.y, 0};
-            transform.rotation = { 0, 0, Degree(rigidBody.rotation) };
-           
 
             rigidBody.torque = 0.0f;
             rigidBody.force = Vec2{};//Vector2Zero();
         }
 
+        //refresh the sin and cos of every body that turned in one batch
+        mTurnedSines.resize(mTurnedAngles.size());
+        mTurnedCosines.resize(mTurnedAngles.size());
+        SinCosBatch(mTurnedAngles.data(), mTurnedSines.data(), mTurnedCosines.data(), mTurnedAngles.size());
+        for (size_t i{}; i < mTurnedBodies.size(); ++i) {
+            mTurnedBodies[i]->rotationSin = mTurnedSines[i];
+            mTurnedBodies[i]->rotationCos = mTurnedCosines[i];
+            mTurnedBodies[i]->cachedRotation = mTurnedAngles[i];
+        }
+        mTurnedBodies.clear();
+        mTurnedAngles.clear();
+
+        //both integrations count as integrate
+        auto end{ ProfileClock::now() };
+        mProfile.prestepNs = elapsedNs(forcesEnd, prestepEnd);
+        mProfile.iterationsNs = elapsedNs(prestepEnd, iterationsEnd);
+        mProfile.integrateNs = elapsedNs(start, forcesEnd) + elapsedNs(iterationsEnd, end);
+
+        ++mFrame;
+        if (!mHistory.empty()) SaveSnapshot(mHistory[mFrame % mHistory.size()]);
 	}
+    /*  _________________________________________________________________________ */
+/*! PhysicsSystem::HashState
 
+@return uint64_t FNV-1a hash of the exact bits of every body's position,
+rotation and velocities, in entity order.
+
+Two runs of the same scene with the same inputs give the same hash, any
+difference in the last bit of any body changes it. Used to check replays
+and physics changes for drift.
+*/
+
+    uint64_t PhysicsSystem::HashState() const {
+        uint64_t hash{ 14695981039346656037ull };
+        auto mix = [&hash](float value) {
+            uint32_t bits{ std::bit_cast<uint32_t>(value) };
+            for (int i{}; i < 4; ++i) {
+                hash ^= (bits >> (i * 8)) & 0xFFu;
+                hash *= 1099511628211ull;
+            }
+        };
+        for (auto const& entity : mEntities) {
+            auto const& rigidBody = gCoordinator->GetComponent<RigidBody>(entity);
+            mix(rigidBody.position.x);
+            mix(rigidBody.position.y);
+            mix(rigidBody.rotation);
+            mix(rigidBody.velocity.x);
+            mix(rigidBody.velocity.y);
+            mix(rigidBody.angularVelocity);
+        }
+        return hash;
+    }
     /*  _________________________________________________________________________ */
-/*! PhysicsSystem::CollisionListener
+/*! PhysicsSystem::SaveSnapshot
+
+@param out Filled with the state of every body, joint and contact.
+
+@return none.
+
+Only copies into out's existing buffers, so saving into the same snapshot
+every step stops allocating once the buffers have grown to the scene.
+*/
+
+    void PhysicsSystem::SaveSnapshot(PhysicsSnapshot& out) const {
+        out.frame = mFrame;
+        out.isValid = true;
+        out.bodies.clear();
+        for (auto const& entity : mEntities) {
+            auto const& rigidBody = gCoordinator->GetComponent<RigidBody>(entity);
+            out.bodies.emplace_back(BodyState{ entity, rigidBody.position, rigidBody.velocity, rigidBody.force,
+                rigidBody.rotation, rigidBody.angularVelocity, rigidBody.torque, rigidBody.isGrounded });
+        }
+        if (auto jointSystem{ gCoordinator->GetSystem<JointSystem>() }) jointSystem->SaveState(out.joints);
+        else out.joints.clear();
+        gCoordinator->GetSystem<Collision::CollisionSystem>()->SaveState(out.contacts);
+    }
+    /*  _________________________________________________________________________ */
+/*! PhysicsSystem::RestoreSnapshot
+
+@param snapshot A snapshot from SaveSnapshot.
 
-@param event The event containing collision data.
+@return none.
 
-Event listener function that gets called when a collision is detected. Checks
-if an arbiter for the colliding pair already exists in the arbiter table. If
-it does, it merges the contacts; otherwise, it adds a new arbiter to the table.
+Puts the world back the way it was at the end of the snapshot's step, the
+next step then gives exactly the same result it gave the first time.
+Bodies destroyed since are skipped and bodies created since are left as
+they are. Later snapshots in the history are dropped since the world may
+now go a different way.
 */
 
-    void PhysicsSystem::CollisionListener(Event& event) {
-        auto const& ap{ event.GetParam<ArbiterPair>(Events::Physics::Collision::COLLIDED) };
-        ArbiterHashTable::iterator iter = mArbiterTable.find(ap.first);
-        //HashTableGet(&world->arbiter_table, hashTableKey);
-        if (iter == mArbiterTable.end()) {
-            mArbiterTable.emplace(ap.first, ap.second);
+    void PhysicsSystem::RestoreSnapshot(PhysicsSnapshot const& snapshot) {
+        for (auto const& body : snapshot.bodies) {
+            if (!gCoordinator->HasComponent<RigidBody>(body.entity)) continue;
+            auto& rigidBody = gCoordinator->GetComponent<RigidBody>(body.entity);
+            rigidBody.position = body.position;
+            rigidBody.velocity = body.velocity;
+            rigidBody.force = body.force;
+            rigidBody.rotation = body.rotation;
+            rigidBody.angularVelocity = body.angularVelocity;
+            rigidBody.torque = body.torque;
+            rigidBody.isGrounded = body.isGrounded;
+            rigidBody.CacheRotation();
+            if (!gCoordinator->HasComponent<Transform>(body.entity)) continue;
+            auto& transform = gCoordinator->GetComponent<Transform>(body.entity);
+            transform.position = { rigidBody.position.x, rigidBody.position.y, 0 };
+            transform.rotation = { 0, 0, Degree(rigidBody.rotation) };
         }
-        else {
-            ArbiterMergeContacts(iter->second, ap.second);
+        if (auto jointSystem{ gCoordinator->GetSystem<JointSystem>() }) jointSystem->RestoreState(snapshot.joints);
+        gCoordinator->GetSystem<Collision::CollisionSystem>()->RestoreState(snapshot.contacts);
+
+        mFrame = snapshot.frame;
+        for (auto& saved : mHistory) {
+            if (saved.frame > mFrame) saved.isValid = false;
         }
     }
+    /*  _________________________________________________________________________ */
+/*! PhysicsSystem::SetHistoryLength
+
+@param length The number of steps to keep, 0 stops saving.
+
+@return none.
+
+Clears the history.
+*/
+
+    void PhysicsSystem::SetHistoryLength(size_t length) {
+        mHistory.clear();
+        mHistory.resize(length);
+    }
+    /*  _________________________________________________________________________ */
+/*! PhysicsSystem::Rewind
+
+@param frame The step to go back to, see GetFrame.
+
+@return bool true if the step was still in the history and was restored.
+*/
+
+    bool PhysicsSystem::Rewind(uint64_t frame) {
+        if (mHistory.empty()) return false;
+        PhysicsSnapshot const& snapshot{ mHistory[frame % mHistory.size()] };
+        if (!snapshot.isValid || snapshot.frame != frame) return false;
+        RestoreSnapshot(snapshot);
+        return true;
+    }
 }
@@ -31,6 +31,7 @@
 #include "Components/OrthoCamera.hpp"
 #include "Components/BoxCollider.hpp"
 #include "Components/RigidBody.hpp"
+#include <bit>
 
 
 namespace {
@@ -47,6 +48,72 @@ Retrieves the camera entity used in the rendering context.
 */
 Entity RenderSystem::GetCamera() { return mCamera; }
 
+/*  _________________________________________________________________________ */
+/*!
+\brief MakeSortKey Function
+
+Packs what the render queue is ordered by into one key, layer in the top
+byte, then the depth, then the texture handle in the low 24 bits. Sorting
+the keys gives the layer then depth order the queue always had, and
+sprites at the same depth end up next to others on the same texture so
+they share texture units and batches. There is only the one quad shader,
+so no bits are spent on a material.
+
+\param transform The transform of the sprite.
+\param sprite The sprite.
+
+\return The sort key.
+*/
+uint64_t RenderSystem::MakeSortKey(Transform const& transform, Sprite const& sprite) {
+	//flip the float so its bits order the same way as the value
+	uint32_t depth{ std::bit_cast<uint32_t>(transform.position.z) };
+	depth = (depth & 0x80000000u) ? ~depth : depth | 0x80000000u;
+	uint64_t texHdl{ sprite.texture ? sprite.texture->GetTexture()->GetTexHdl() : 0u };
+	return (static_cast<uint64_t>(sprite.layer) << 56) | (static_cast<uint64_t>(depth) << 24) | (texHdl & 0xFFFFFF);
+}
+
+/*  _________________________________________________________________________ */
+/*!
+\brief PushSpriteBounds Function
+
+Appends the world space box around the sprite's quad, the quad being
+scale.x by scale.y around the position turned by rotation.z, using the
+sin and cos the transform keeps.
+
+\param transform The transform of the sprite.
+\param bounds The boxes to append to.
+*/
+void RenderSystem::PushSpriteBounds(Transform const& transform, Collision::AABBSoA& bounds) {
+	glm::vec2 cosSin{ transform.GetRotationCosSin() };
+	float halfX{ 0.5f * (fabsf(cosSin.x * transform.scale.x) + fabsf(cosSin.y * transform.scale.y)) };
+	float halfY{ 0.5f * (fabsf(cosSin.y * transform.scale.x) + fabsf(cosSin.x * transform.scale.y)) };
+	bounds.Push(Vec2{ transform.position.x - halfX, transform.position.y - halfY },
+		Vec2{ transform.position.x + halfX, transform.position.y + halfY });
+}
+
+/*  _________________________________________________________________________ */
+/*!
+\brief CullSprites Function
+
+Tests every sprite box against the rectangle the camera sees, 4 or 8 at a
+time with the aabb batch kernel, and adds the counts to the renderer stats.
+
+\param camera The camera the sprites are drawn with.
+\param bounds The sprite boxes, from PushSpriteBounds.
+\param visibleMask Set to one bit per box, set when the box is in view.
+
+\return The number of sprites in view.
+*/
+size_t RenderSystem::CullSprites(OrthoCamera const& camera, Collision::AABBSoA const& bounds, std::vector<uint32_t>& visibleMask) {
+	glm::vec2 viewMin, viewMax;
+	camera.GetViewBounds(viewMin, viewMax);
+	size_t count{ bounds.Size() };
+	visibleMask.resize(Collision::AABBMaskWords(count));
+	size_t visible{ count ? Collision::OverlapBatch(Vec2{ viewMin.x, viewMin.y }, Vec2{ viewMax.x, viewMax.y }, bounds, 0, count, visibleMask.data()) : 0 };
+	Renderer::AddCullCounts(static_cast<unsigned int>(visible), static_cast<unsigned int>(count - visible));
+	return visible;
+}
+
 /*  _________________________________________________________________________ */
 /*!
 \brief GetFramebuffer Function
@@ -75,6 +142,7 @@ void RenderSystem::Init()
 {
 	gCoordinator = Coordinator::GetInstance();
 	gCoordinator->AddEventListener(METHOD_LISTENER(Events::Window::RESIZED, RenderSystem::WindowSizeListener));
+	gCoordinator->AddEventListener(METHOD_LISTENER(Events::System::ENTITY, RenderSystem::EntityListener));
 
 	mCamera = gCoordinator->CreateEntity();
 	gCoordinator->AddComponent(
@@ -93,8 +161,7 @@ void RenderSystem::Init()
 		OrthoCamera{aspectRatio, static_cast<float>(-WORLD_LIMIT_X) * aspectRatio, static_cast<float>(WORLD_LIMIT_X) * aspectRatio, static_cast<float>(-WORLD_LIMIT_Y), static_cast<float>(WORLD_LIMIT_Y)}
 	);
 
-	std::shared_ptr<Texture> bgTex = std::make_shared<Texture>( "../Textures/blinkbg.png" );
-	mBgSubtex = SubTexture::Create(bgTex, { 0, 0 }, { 3497, 1200 });
+	mBgSubtex = SubTexture::Create("../Textures/blinkbg.png", 0);
 	Entity bg = gCoordinator->CreateEntity();
 	::gCoordinator->AddComponent(
 		bg,
@@ -109,7 +176,8 @@ void RenderSystem::Init()
 		Sprite{
 			{1.f,1.f,1.f,1.f},
 			mBgSubtex,
-			Layer::BACKGROUND
+			Layer::BACKGROUND,
+			true
 		}
 	);
 	
@@ -141,40 +209,55 @@ void RenderSystem::Update([[maybe_unused]] float dt)
 	Renderer::ClearColor();
 	Renderer::ClearDepth();
 
+	Renderer::ResetStats();
+	CheckStaticSprites();
+	if (!mIsStaticValid) BuildStaticSprites();
+	else if (mHasEntityChanges) CollectDynamicEntities();
+
 	mRenderQueue.clear();
+	mSpriteBounds.Clear();
+
+	//static sprites are drawn from their batch, not looked at again
+	for (auto const& entity : mDynamicEntities) {
+		Transform& transform{ ::gCoordinator->GetComponent<Transform>(entity) };
+		Sprite& sprite{ ::gCoordinator->GetComponent<Sprite>(entity) };
+		//newly flagged, baked from the next frame on, seen or not
+		if (sprite.isStatic) mIsStaticValid = false;
+		PushSpriteBounds(transform, mSpriteBounds);
+		mRenderQueue.push_back(RenderEntry{ .entity = entity, .transform = &transform, .sprite = &sprite });
+	}
 
-	for (auto const& entity : mEntities) {
-		RenderEntry entry{
-			.entity = entity,
-			.transform = &::gCoordinator->GetComponent<Transform>(entity),
-			.sprite = &::gCoordinator->GetComponent<Sprite>(entity)
-		};
-		mRenderQueue.push_back(entry);
-		
+	//only what the camera sees is looked at again, sorted and drawn
+	auto const& camera = ::gCoordinator->GetComponent<OrthoCamera>(mCamera);
+	CullSprites(camera, mSpriteBounds, mVisibleMask);
+	size_t kept{};
+	for (size_t word{}; word < mVisibleMask.size(); ++word) {
+		for (uint32_t bits{ mVisibleMask[word] }; bits; bits &= bits - 1) {
+			mRenderQueue[kept++] = mRenderQueue[word * 32 + std::countr_zero(bits)];
+		}
 	}
+	mRenderQueue.resize(kept);
 
-	std::sort(mRenderQueue.begin(), mRenderQueue.end(),
-		[](RenderEntry const& lhs, RenderEntry const& rhs) {
-			// First, sort by layer
-			if (lhs.sprite->layer != rhs.sprite->layer) {
-				return static_cast<int>(lhs.sprite->layer) < static_cast<int>(rhs.sprite->layer);
-			}
-			// If they are in the same layer, sort by z-position
-			return lhs.transform->position.z < rhs.transform->position.z;
-		});
+	//one key per entry in draw order, sorted without touching the components again
+	mSortKeys.clear();
+	for (size_t i{}; i < mRenderQueue.size(); ++i) {
+		mSortKeys.push_back(Image::KeyIndex{ MakeSortKey(*mRenderQueue[i].transform, *mRenderQueue[i].sprite), static_cast<uint32_t>(i) });
+	}
+	Image::RadixSort(mSortKeys, mSortScratch);
 
 
-	auto const& camera = ::gCoordinator->GetComponent<OrthoCamera>(mCamera);
 	Renderer::RenderSceneBegin(camera);
-	for (auto const& entry : mRenderQueue)
-	{
-
-		if (entry.sprite->texture) {
-			Renderer::DrawSprite(*entry.transform, entry.sprite->texture, entry.sprite->color);
-		}
-		else {
-			Renderer::DrawQuad(entry.transform->position, entry.transform->scale, entry.sprite->color, entry.transform->rotation.z);
+	//layer by layer, the static batch of the layer first, then its part of the sorted
+	//queue drawn as instances of one quad, written over threads
+	size_t next{};
+	for (size_t layer{}; layer < cLayerCount; ++layer) {
+		Renderer::DrawStaticBatch(mStaticBatches[layer]);
+		mQuadDraws.clear();
+		for (; next < mSortKeys.size() && (mSortKeys[next].key >> 56) <= layer; ++next) {
+			RenderEntry const& entry{ mRenderQueue[mSortKeys[next].index] };
+			mQuadDraws.push_back(QuadDraw{ entry.transform, entry.sprite->texture.get(), entry.sprite->color });
 		}
+		Renderer::DrawQuadsInstanced(mQuadDraws);
 	}
 
 	glDepthMask(GL_TRUE);
@@ -187,6 +270,116 @@ void RenderSystem::Update([[maybe_unused]] float dt)
 	mFramebuffer->Unbind();
 }
 
+/*  _________________________________________________________________________ */
+/*!
+\brief CheckStaticSprites Function
+
+Compares every baked sprite with what it was baked with, the version of
+its transform, its texture, color, layer and static flag, and marks the
+batches to be built again on the first difference. The components are
+read through the pointers kept in the entries, only looked up again after
+an entity or component was removed, since that may move them, and a baked
+entity that is gone also means a rebuild. Costs a few compares per static
+sprite when nothing changed.
+*/
+void RenderSystem::CheckStaticSprites() {
+	if (!mIsStaticValid) return;
+	if (mHasMovedComponents) {
+		mHasMovedComponents = false;
+		for (auto& entry : mStaticEntries) {
+			if (!mEntities.contains(entry.entity)) {
+				mIsStaticValid = false;
+				return;
+			}
+			entry.transform = &::gCoordinator->GetComponent<Transform>(entry.entity);
+			entry.sprite = &::gCoordinator->GetComponent<Sprite>(entry.entity);
+		}
+	}
+	for (auto const& entry : mStaticEntries) {
+		entry.transform->Refresh();
+		Sprite const& sprite{ *entry.sprite };
+		if (entry.transform->version != entry.version || !sprite.isStatic || sprite.texture.get() != entry.subtex
+			|| sprite.color != entry.color || sprite.layer != entry.layer) {
+			mIsStaticValid = false;
+			return;
+		}
+	}
+}
+
+/*  _________________________________________________________________________ */
+/*!
+\brief BuildStaticSprites Function
+
+Collects every sprite flagged static, orders them by MakeSortKey and
+bakes one static batch per layer. They are not culled, the whole batch is
+drawn every frame.
+*/
+void RenderSystem::BuildStaticSprites() {
+	mStaticEntries.clear();
+	mIsStaticEntity.assign(MAX_ENTITIES, false);
+	mSortKeys.clear();
+	for (auto const& entity : mEntities) {
+		Sprite const& sprite{ ::gCoordinator->GetComponent<Sprite>(entity) };
+		if (!sprite.isStatic) continue;
+		Transform const& transform{ ::gCoordinator->GetComponent<Transform>(entity) };
+		transform.Refresh();
+		mSortKeys.push_back(Image::KeyIndex{ MakeSortKey(transform, sprite), static_cast<uint32_t>(mStaticEntries.size()) });
+		mStaticEntries.push_back(StaticEntry{ entity, &transform, &sprite, transform.version, sprite.texture.get(), sprite.color, sprite.layer });
+		mIsStaticEntity[entity] = true;
+	}
+	Image::RadixSort(mSortKeys, mSortScratch);
+
+	size_t next{};
+	for (size_t layer{}; layer < cLayerCount; ++layer) {
+		mQuadDraws.clear();
+		for (; next < mSortKeys.size() && (mSortKeys[next].key >> 56) <= layer; ++next) {
+			StaticEntry const& entry{ mStaticEntries[mSortKeys[next].index] };
+			mQuadDraws.push_back(QuadDraw{ entry.transform, entry.subtex, entry.color });
+		}
+		Renderer::BuildStaticBatch(mQuadDraws, mStaticBatches[layer]);
+	}
+	mIsStaticValid = true;
+	mHasMovedComponents = false;
+	CollectDynamicEntities();
+}
+
+/*  _________________________________________________________________________ */
+/*!
+\brief CollectDynamicEntities Function
+
+Lists the entities that are not in a static batch, the ones the queue is
+built from every frame. Only done again when the static sprites are baked
+or an entity or component was added, cloned or removed.
+*/
+void RenderSystem::CollectDynamicEntities() {
+	mDynamicEntities.clear();
+	for (auto const& entity : mEntities) {
+		if (!mIsStaticEntity[entity]) mDynamicEntities.push_back(entity);
+	}
+	mHasEntityChanges = false;
+}
+
+/*  _________________________________________________________________________ */
+/*!
+\brief EntityListener Function
+
+Notes that the entities have to be collected again. When an entity or one
+of its components was removed, the last component of the array is moved
+into its place, so the pointers of the static entries are also looked up
+again before they are next read.
+
+\param event The entity event.
+*/
+void RenderSystem::EntityListener(Event& event) {
+	mHasEntityChanges = true;
+#undef DELETE
+	event.GetParam<Entity>(Events::System::Entity::DELETE);
+#define DELETE                           (0x00010000L)
+	bool isRemoval{ !event.GetFail() };
+	event.GetParam<Entity>(Events::System::Entity::COMPONENT_REMOVE);
+	if (isRemoval || !event.GetFail()) mHasMovedComponents = true;
+}
+
 /*  _________________________________________________________________________ */
 /*!
 \brief WindowSizeListener Function
@@ -274,5 +274,88 @@ namespace Image
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
         internal extern static bool Input_IsMouseReleased(int key);
         #endregion
+
+        #region Physics
+        // For Physics
+        /*  _________________________________________________________________________ */
+        /*! Physics_Raycast
+
+        @param origin
+        Start of the ray.
+
+        @param end
+        End of the ray.
+
+        @param entityHandle
+        The ID of the closest entity hit.
+
+        @param point
+        The point where the ray hits.
+
+        @param normal
+        The normal of the face that is hit.
+
+        @param fraction
+        How far along the ray the hit is, from 0 to 1.
+
+        @return bool
+        Returns true if something is hit.
+
+        Cast a ray against the colliders and get the closest hit.
+        */
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal extern static bool Physics_Raycast(ref Vector2 origin, ref Vector2 end, out uint entityHandle, out Vector2 point, out Vector2 normal, out float fraction);
+
+        /*  _________________________________________________________________________ */
+        /*! Physics_RaycastAll
+
+        @param origin
+        Start of the ray.
+
+        @param end
+        End of the ray.
+
+        @return uint[]
+        The IDs of every entity hit, nearest first.
+
+        Cast a ray against the colliders and get every hit.
+        */
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal extern static uint[] Physics_RaycastAll(ref Vector2 origin, ref Vector2 end);
+
+        /*  _________________________________________________________________________ */
+        /*! Physics_QueryAABB
+
+        @param min
+        The bottom left corner of the region.
+
+        @param max
+        The top right corner of the region.
+
+        @return uint[]
+        The IDs of every entity overlapping the region.
+
+        Get the entities in a box region.
+        */
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal extern static uint[] Physics_QueryAABB(ref Vector2 min, ref Vector2 max);
+
+        /*  _________________________________________________________________________ */
+        /*! Physics_QueryRadius
+
+        @param center
+        The center of the circle.
+
+        @param radius
+        The radius of the circle.
+
+        @return uint[]
+        The IDs of every entity within the circle, nearest first.
+
+        Get the entities within a radius.
+        */
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal extern static uint[] Physics_QueryRadius(ref Vector2 center, float radius);
+        #endregion
     }
 }
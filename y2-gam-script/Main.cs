@@ -23,6 +23,11 @@ namespace Image
     {
         protected uint entityID;
 
+        // Optional callbacks, looked up by name from C++ when the script is created:
+        //   void OnContactBegin(uint other) / void OnContactEnd(uint other)
+        //   void OnTriggerBegin(uint other) / void OnTriggerEnd(uint other)
+        // Begin/End are only sent on the step the pair starts or stops touching.
+
         /*  _________________________________________________________________________ */
         /*! Entity
         
@@ -0,0 +1,111 @@
+﻿/******************************************************************************/
+/*!
+\par        Image Engine
+\file       Physics.cs
+
+\author     tan cheng hian (t.chenghian)
+\date       Nov 2, 2023
+
+\brief      A helper wrapper class for spatial queries against the colliders,
+            region, radius and raycast.
+
+\copyright  Copyright (C) 2023 DigiPen Institute of Technology. Reproduction
+            or disclosure of this file or its contents without the prior
+            written consent of DigiPen Institute of Technology is prohibited.
+*/
+/******************************************************************************/
+
+namespace Image
+{
+    public struct RaycastHit
+    {
+        public uint EntityHandle;
+        public Vector2 Point;
+        public Vector2 Normal;
+        public float Fraction;
+    }
+
+    public class Physics
+    {
+        /*  _________________________________________________________________________ */
+        /*! Raycast
+
+        @param origin
+        Start of the ray.
+
+        @param end
+        End of the ray.
+
+        @param hit
+        The closest hit, if any.
+
+        @return bool
+        Returns true if something is hit.
+
+        Cast a ray and get the closest collider hit. Colliders containing
+        the origin are ignored, so a ray can be cast from inside the caster.
+        */
+        public static bool Raycast(Vector2 origin, Vector2 end, out RaycastHit hit)
+        {
+            hit = new RaycastHit();
+            return InternalCalls.Physics_Raycast(ref origin, ref end, out hit.EntityHandle, out hit.Point, out hit.Normal, out hit.Fraction);
+        }
+
+        /*  _________________________________________________________________________ */
+        /*! RaycastAll
+
+        @param origin
+        Start of the ray.
+
+        @param end
+        End of the ray.
+
+        @return uint[]
+        The IDs of every entity hit, nearest first.
+
+        Cast a ray and get every collider it passes through.
+        */
+        public static uint[] RaycastAll(Vector2 origin, Vector2 end)
+        {
+            return InternalCalls.Physics_RaycastAll(ref origin, ref end);
+        }
+
+        /*  _________________________________________________________________________ */
+        /*! QueryAABB
+
+        @param min
+        The bottom left corner of the region.
+
+        @param max
+        The top right corner of the region.
+
+        @return uint[]
+        The IDs of every entity overlapping the region.
+
+        Get the colliders in a box region, e.g. what is under the mouse.
+        */
+        public static uint[] QueryAABB(Vector2 min, Vector2 max)
+        {
+            return InternalCalls.Physics_QueryAABB(ref min, ref max);
+        }
+
+        /*  _________________________________________________________________________ */
+        /*! QueryRadius
+
+        @param center
+        The center of the circle.
+
+        @param radius
+        The radius of the circle.
+
+        @return uint[]
+        The IDs of every entity within the circle, nearest first.
+
+        Get the colliders within a radius, the first entry is the nearest.
+        */
+        public static uint[] QueryRadius(Vector2 center, float radius)
+        {
+            return InternalCalls.Physics_QueryRadius(ref center, radius);
+        }
+    }
+}